@@ -0,0 +1,70 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace toolbox::benchmark
+{
+    /// Prevent the compiler from optimizing away computation of the \p value.
+    /// \tparam T Type of the value, should be trivially copyable.
+    /// \param value Value to be kept.
+    template <typename T>
+    void keep(const T &value)
+    {
+        [[maybe_unused]] static volatile T sink{};
+        sink = value;
+    }
+
+    /// Run the \p operation \p iterations times and print the average time of a single run.
+    /// \tparam Operation Callable type without parameters.
+    /// \param name Name printed next to the result.
+    /// \param iterations How many times the \p operation should be run.
+    /// \param operation Measured operation.
+    template <class Operation>
+    void measure(const char *name, size_t iterations, Operation &&operation)
+    {
+        // warm up caches and branch predictors:
+        operation();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            operation();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        const std::chrono::duration<double, std::nano> elapsed = stop - start;
+        std::printf("%-64s %12.2f ns/op\n", name, elapsed.count() / static_cast<double>(iterations));
+    }
+
+    void runStringBenchmarks();
+
+    void runMemoryBenchmarks();
+
+    void runContainerBenchmarks();
+}
@@ -0,0 +1,347 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "./benchmark.hpp"
+#include "../src/toolbox/containers/membership.hpp"
+#include "../src/toolbox/containers/query.hpp"
+#include "../src/toolbox/containers/remove.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::vector<uint64_t> makeRandomValues(size_t count, uint64_t seed)
+    {
+        std::vector<uint64_t> values(count);
+        uint64_t value{seed};
+        for (auto &current : values)
+        {
+            value = value * 6364136223846793005u + 1442695040888963407u;
+            current = value;
+        }
+        return values;
+    }
+
+    /// Measure building of the index over \p whitelist and looking up all of the \p source elements, with each strategy
+    /// and with the automatic selection of containsOnly.
+    template <class Container>
+    void benchmarkStrategies(const char *scenario, const Container &source, const Container &whitelist, size_t iterations)
+    {
+        using toolbox::container::membership_strategy_t;
+
+        const std::pair<membership_strategy_t, const char *> strategies[] = {
+                {membership_strategy_t::linear, "linear"},
+                {membership_strategy_t::bitmap, "bitmap"},
+                {membership_strategy_t::hash,   "hash"},
+                {membership_strategy_t::sorted, "sorted"}};
+
+        for (const auto &strategy : strategies)
+        {
+            const toolbox::container::MembershipIndex<Container> probe{whitelist, strategy.first};
+            if (probe.strategy() != strategy.first)
+            {
+                continue;
+            }
+
+            const std::string name = std::string{scenario} + ": " + strategy.second;
+            toolbox::benchmark::measure(name.c_str(), iterations, [&source, &whitelist, &strategy]
+            {
+                const toolbox::container::MembershipIndex<Container> index{whitelist, strategy.first};
+                size_t found{0};
+                for (const auto &element : source)
+                {
+                    found += index.contains(element) ? 1u : 0u;
+                }
+                toolbox::benchmark::keep(found);
+            });
+        }
+
+        const std::string name = std::string{scenario} + ": containsOnly";
+        toolbox::benchmark::measure(name.c_str(), iterations, [&source, &whitelist]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsOnly(source, whitelist));
+        });
+    }
+
+    void benchmarkMembershipStrategies()
+    {
+        {
+            std::vector<int> source{3, 1, 4, 1, 5, 9, 2, 6};
+            std::vector<int> whitelist{1, 2, 3, 4, 5, 6, 7, 9};
+            benchmarkStrategies("tiny int (8 in 8)", source, whitelist, 100000);
+        }
+        {
+            std::vector<int> source(10000);
+            std::vector<int> whitelist(5000);
+            for (size_t i = 0; i < whitelist.size(); ++i)
+            {
+                whitelist[i] = static_cast<int>(whitelist.size() - i);
+            }
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                source[i] = static_cast<int>((i * 7919) % whitelist.size()) + 1;
+            }
+            benchmarkStrategies("dense int (10k in 5k)", source, whitelist, 5);
+        }
+        {
+            const auto whitelist = makeRandomValues(5000, 1);
+            std::vector<uint64_t> source(10000);
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                source[i] = whitelist[(i * 7919) % whitelist.size()];
+            }
+            benchmarkStrategies("sparse uint64_t (10k in 5k)", source, whitelist, 5);
+        }
+        {
+            std::vector<std::string> whitelist;
+            for (const auto value : makeRandomValues(5000, 2))
+            {
+                whitelist.push_back("user-" + std::to_string(value));
+            }
+            std::vector<std::string> source(10000);
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                source[i] = whitelist[(i * 7919) % whitelist.size()];
+            }
+            benchmarkStrategies("std::string (10k in 5k)", source, whitelist, 5);
+        }
+        {
+            // ordered, but not hashable:
+            std::vector<std::pair<int, int>> whitelist(5000);
+            for (size_t i = 0; i < whitelist.size(); ++i)
+            {
+                whitelist[i] = {static_cast<int>(i % 71), static_cast<int>(i)};
+            }
+            std::vector<std::pair<int, int>> source(10000);
+            for (size_t i = 0; i < source.size(); ++i)
+            {
+                source[i] = whitelist[(i * 7919) % whitelist.size()];
+            }
+            benchmarkStrategies("std::pair<int, int> (10k in 5k)", source, whitelist, 5);
+        }
+    }
+
+    void benchmarkSortedRanges()
+    {
+        using toolbox::container::sorted_range;
+
+        // disjoint sorted ranges (odd and even values), so containsAny has to walk both of them:
+        std::vector<uint32_t> odd(100000);
+        std::vector<uint32_t> even(100000);
+        for (size_t i = 0; i < odd.size(); ++i)
+        {
+            odd[i] = static_cast<uint32_t>(2 * i + 1);
+            even[i] = static_cast<uint32_t>(2 * i);
+        }
+        const std::vector<uint64_t> odd64(odd.cbegin(), odd.cend());
+        const std::vector<uint64_t> even64(even.cbegin(), even.cend());
+
+        toolbox::benchmark::measure("containsAny uint32_t (100k, 100k, disjoint)", 20, [&odd, &even]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsAny(odd, even));
+        });
+        toolbox::benchmark::measure("containsAny sorted_range uint64_t merge (100k, 100k, disjoint)", 20, [&odd64, &even64]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsAny(sorted_range, odd64, even64));
+        });
+        toolbox::benchmark::measure("containsAny sorted_range uint32_t SIMD (100k, 100k, disjoint)", 20, [&odd, &even]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsAny(sorted_range, odd, even));
+        });
+
+        const std::vector<uint32_t> fewOdd{1001, 20001, 30001, 150001, 199999};
+        toolbox::benchmark::measure("containsOnly (5 in 100k)", 20, [&fewOdd, &odd]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsOnly(fewOdd, odd));
+        });
+        toolbox::benchmark::measure("containsOnly sorted_range galloping (5 in 100k)", 20, [&fewOdd, &odd]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsOnly(sorted_range, fewOdd, odd));
+        });
+
+        toolbox::benchmark::measure("removeElements uint32_t (100k, 100k)", 20, [&odd, &even]
+        {
+            toolbox::benchmark::keep(toolbox::container::removeElements(odd, even).size());
+        });
+        toolbox::benchmark::measure("removeElements sorted_range uint32_t (100k, 100k)", 20, [&odd, &even]
+        {
+            toolbox::benchmark::keep(toolbox::container::removeElements(sorted_range, odd, even).size());
+        });
+    }
+
+    void benchmarkParallelSearch()
+    {
+        using toolbox::container::parallel;
+
+        std::vector<uint32_t> values(16 * 1024 * 1024);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<uint32_t>(2 * i + 1);
+        }
+
+        const std::pair<const char *, uint32_t> positions[] = {
+                {"1%",   values[values.size() / 100]},
+                {"50%",  values[values.size() / 2]},
+                {"99%",  values[values.size() / 100 * 99]},
+                {"miss", 0}};
+
+        for (const auto &position : positions)
+        {
+            const uint32_t searched = position.second;
+            const std::string name = std::string{"contains (16M uint32_t, match at "} + position.first + ")";
+            toolbox::benchmark::measure(name.c_str(), 10, [&values, searched]
+            {
+                toolbox::benchmark::keep(toolbox::container::contains(values, searched));
+            });
+            const std::string parallelName = std::string{"contains parallel (16M uint32_t, match at "} + position.first + ")";
+            toolbox::benchmark::measure(parallelName.c_str(), 10, [&values, searched]
+            {
+                toolbox::benchmark::keep(toolbox::container::contains(parallel, values, searched));
+            });
+        }
+
+        const std::vector<uint32_t> whitelist{0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+        toolbox::benchmark::measure("containsAny (16M uint32_t in 16, miss)", 10, [&values, &whitelist]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsAny(values, whitelist));
+        });
+        toolbox::benchmark::measure("containsAny parallel (16M uint32_t in 16, miss)", 10, [&values, &whitelist]
+        {
+            toolbox::benchmark::keep(toolbox::container::containsAny(parallel, values, whitelist));
+        });
+    }
+
+    template <class T>
+    void benchmarkSimdSearch(const char *typeName)
+    {
+        std::vector<T> values(1024 * 1024);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<T>(i % 100 + 1);
+        }
+        const T missing{0};
+
+        const std::string findName = std::string{"std::find miss (1M "} + typeName + ")";
+        toolbox::benchmark::measure(findName.c_str(), 50, [&values, missing]
+        {
+            toolbox::benchmark::keep(std::find(values.cbegin(), values.cend(), missing) != values.cend());
+        });
+        const std::string containsName = std::string{"contains SIMD miss (1M "} + typeName + ")";
+        toolbox::benchmark::measure(containsName.c_str(), 50, [&values, missing]
+        {
+            toolbox::benchmark::keep(toolbox::container::contains(values, missing));
+        });
+    }
+
+    /// Measure lookups of mostly absent elements in a blacklist much bigger than the caches, with and without Bloom filter.
+    void benchmarkBloomPrefilter()
+    {
+        const auto blacklist = makeRandomValues(2 * 1024 * 1024, 3);
+        auto source = makeRandomValues(1024 * 1024, 4);
+        for (size_t i = 0; i < source.size(); i += 100)
+        {
+            source[i] = blacklist[i];
+        }
+
+        using Index = toolbox::container::MembershipIndex<std::vector<uint64_t>>;
+        const Index hashed{blacklist, source.size()};
+        const Index prefiltered{blacklist, source.size(), toolbox::container::bloom_filter};
+        const std::pair<const Index *, const char *> indexes[] = {
+                {&hashed,      "contains miss-heavy (1M in 2M uint64_t): hash"},
+                {&prefiltered, "contains miss-heavy (1M in 2M uint64_t): Bloom filter + hash"}};
+        for (const auto &index : indexes)
+        {
+            toolbox::benchmark::measure(index.second, 5, [&source, &index]
+            {
+                size_t found{0};
+                for (const auto &element : source)
+                {
+                    found += index.first->contains(element) ? 1u : 0u;
+                }
+                toolbox::benchmark::keep(found);
+            });
+        }
+
+        toolbox::benchmark::measure("removeElements (1M, 2M uint64_t)", 3, [&source, &blacklist]
+        {
+            toolbox::benchmark::keep(toolbox::container::removeElements(source, blacklist).size());
+        });
+        toolbox::benchmark::measure("removeElements bloom_filter (1M, 2M uint64_t)", 3, [&source, &blacklist]
+        {
+            toolbox::benchmark::keep(toolbox::container::removeElements(toolbox::container::bloom_filter, source, blacklist).size());
+        });
+    }
+
+    void benchmarkDeduplication()
+    {
+        auto ids = makeRandomValues(1024 * 1024, 5);
+        for (size_t i = 0; i < ids.size(); i += 2)
+        {
+            ids[i] = ids[(i * 7919) % ids.size()];
+        }
+
+        toolbox::benchmark::measure("dedupe with std::unordered_set copy (1M uint64_t)", 5, [&ids]
+        {
+            std::unordered_set<uint64_t> seen;
+            std::vector<uint64_t> unique;
+            for (const auto id : ids)
+            {
+                if (seen.insert(id).second)
+                {
+                    unique.push_back(id);
+                }
+            }
+            toolbox::benchmark::keep(unique.size());
+        });
+        toolbox::benchmark::measure("dedupe with sort + unique, order lost (1M uint64_t)", 5, [&ids]
+        {
+            auto unique = ids;
+            std::sort(unique.begin(), unique.end());
+            toolbox::benchmark::keep(std::unique(unique.begin(), unique.end()) - unique.begin());
+        });
+        toolbox::benchmark::measure("removeDuplicatesInPlace (1M uint64_t)", 5, [&ids]
+        {
+            auto unique = ids;
+            toolbox::container::removeDuplicatesInPlace(unique);
+            toolbox::benchmark::keep(unique.size());
+        });
+    }
+}
+
+void toolbox::benchmark::runContainerBenchmarks()
+{
+    benchmarkMembershipStrategies();
+    benchmarkSortedRanges();
+    benchmarkParallelSearch();
+    benchmarkSimdSearch<uint8_t>("uint8_t");
+    benchmarkSimdSearch<uint32_t>("uint32_t");
+    benchmarkSimdSearch<uint64_t>("uint64_t");
+    benchmarkSimdSearch<float>("float");
+    benchmarkBloomPrefilter();
+    benchmarkDeduplication();
+}
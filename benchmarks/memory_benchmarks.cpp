@@ -0,0 +1,227 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "./benchmark.hpp"
+#include "../src/toolbox/memory/chopping.hpp"
+#include "../src/toolbox/memory/varint.hpp"
+#include "../src/toolbox/memory/bit_stream.hpp"
+#include "../src/toolbox/memory/checksum.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    std::vector<uint64_t> makeValues(size_t count)
+    {
+        std::vector<uint64_t> values(count);
+        uint64_t value{1};
+        for (auto &current : values)
+        {
+            value = value * 6364136223846793005u + 1442695040888963407u;
+            current = value;
+        }
+        return values;
+    }
+
+    void benchmarkSlicing()
+    {
+        const auto values = makeValues(1024 * 1024);
+        std::vector<uint8_t> bytes(values.size() * sizeof(uint64_t));
+
+        toolbox::benchmark::measure("sliceToChunks<uint8_t> per value (1M x uint64_t)", 20, [&values, &bytes]
+        {
+            auto destination = bytes.begin();
+            for (const auto value : values)
+            {
+                const auto chunks = toolbox::memory::sliceToChunks<uint8_t>(value);
+                destination = std::copy(chunks.cbegin(), chunks.cend(), destination);
+            }
+            toolbox::benchmark::keep(bytes.back());
+        });
+
+        toolbox::benchmark::measure("sliceToChunks<uint8_t> bulk (1M x uint64_t)", 20, [&values, &bytes]
+        {
+            toolbox::memory::sliceToChunks<uint8_t>(values.data(), values.size(), bytes.data());
+            toolbox::benchmark::keep(bytes.back());
+        });
+    }
+
+    void benchmarkByteOrderConversion()
+    {
+        auto values = makeValues(8 * 1024 * 1024);
+
+        toolbox::benchmark::measure("byteswapInPlace<uint64_t> (64 MiB)", 10, [&values]
+        {
+            toolbox::memory::byteswapInPlace(values.data(), values.size());
+            toolbox::benchmark::keep(values.back());
+        });
+
+        toolbox::benchmark::measure("std::memcpy as the bandwidth reference (64 MiB)", 10, [&values]
+        {
+            static std::vector<uint64_t> copy(values.size());
+            std::memcpy(copy.data(), values.data(), values.size() * sizeof(uint64_t));
+            toolbox::benchmark::keep(copy.back());
+        });
+
+        // the shuffles pay off when the buffer is cached:
+        values.resize(32 * 1024);
+        toolbox::benchmark::measure("byteswapInPlace<uint64_t> (256 KiB)", 2000, [&values]
+        {
+            toolbox::memory::byteswapInPlace(values.data(), values.size());
+            toolbox::benchmark::keep(values.back());
+        });
+
+        toolbox::benchmark::measure("detail::byteswapElementsScalar<8> (256 KiB)", 2000, [&values]
+        {
+            toolbox::memory::detail::byteswapElementsScalar<sizeof(uint64_t)>(reinterpret_cast<uint8_t *>(values.data()), values.size());
+            toolbox::benchmark::keep(values.back());
+        });
+    }
+
+    template <size_t width>
+    void benchmarkBitUnpacking(const char *name, const char *scalarName)
+    {
+        const auto values = makeValues(1024 * 1024);
+        std::vector<uint8_t> packed(toolbox::memory::packedSize<width>(values.size()));
+        toolbox::memory::packBits<width>(values.data(), values.size(), packed.data());
+        std::vector<uint64_t> unpacked(values.size());
+
+        toolbox::benchmark::measure(name, 20, [&packed, &unpacked]
+        {
+            toolbox::memory::unpackBits<width>(packed.data(), unpacked.size(), unpacked.data());
+            toolbox::benchmark::keep(unpacked.back());
+        });
+
+        toolbox::benchmark::measure(scalarName, 20, [&packed, &unpacked]
+        {
+            toolbox::memory::detail::unpackBitsScalar<width>(packed.data(), unpacked.size(), unpacked.data());
+            toolbox::benchmark::keep(unpacked.back());
+        });
+    }
+
+    void benchmarkVarintDecoding()
+    {
+        auto values = makeValues(1024 * 1024);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            // mostly short values, as in typical protocols:
+            values[i] >>= 64 - (i % 4 == 0 ? 35 : 12);
+        }
+
+        std::vector<uint8_t> encoded(values.size() * toolbox::memory::maxVarintLength<uint64_t>);
+        size_t size{0};
+        for (const auto value : values)
+        {
+            size += toolbox::memory::encodeVarint(value, encoded.data() + size);
+        }
+        std::vector<uint64_t> decoded(values.size());
+
+        toolbox::benchmark::measure("decodeVarint one by one (1M values)", 20, [&]
+        {
+            size_t offset{0};
+            for (auto &value : decoded)
+            {
+                offset += toolbox::memory::decodeVarint(encoded.data() + offset, size - offset, value);
+            }
+            toolbox::benchmark::keep(offset);
+        });
+
+        toolbox::benchmark::measure("decodeVarints batched (1M values)", 20, [&]
+        {
+            size_t consumed{0};
+            toolbox::memory::decodeVarints(encoded.data(), size, decoded.data(), decoded.size(), consumed);
+            toolbox::benchmark::keep(consumed);
+        });
+    }
+
+    template <toolbox::memory::bit_order_t bitOrder>
+    void benchmarkBitWriting(const char *name)
+    {
+        // mixed widths of 1 - 16 bits, 8.5 bits on average:
+        const auto values = makeValues(1024 * 1024);
+        std::vector<uint8_t> buffer(values.size() * 2);
+
+        toolbox::benchmark::measure(name, 20, [&values, &buffer]
+        {
+            toolbox::memory::BitWriter<bitOrder> writer{buffer.data(), buffer.size()};
+            for (const auto value : values)
+            {
+                writer.write(value, (value >> 60u) + 1);
+            }
+            toolbox::benchmark::keep(writer.finish());
+        });
+    }
+
+    void benchmarkChecksums()
+    {
+        namespace memory = toolbox::memory;
+
+        const auto values = makeValues(512 * 1024);
+        std::vector<uint8_t> data(values.size() * sizeof(uint64_t));
+        std::memcpy(data.data(), values.data(), data.size());
+
+        toolbox::benchmark::measure("CRC-32C slicing-by-8 tables (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::detail::updateCrcWithTables<uint32_t, memory::detail::crc32cPolynomial>(0, data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("crc32c (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::crc32c(data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("CRC-32 slicing-by-8 tables (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::detail::updateCrcWithTables<uint32_t, memory::detail::crc32Polynomial>(0, data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("crc32 (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::crc32(data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("CRC-64 slicing-by-8 tables (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::detail::updateCrcWithTables<uint64_t, memory::detail::crc64Polynomial>(0, data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("crc64 (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::crc64(data.data(), data.size()));
+        });
+        toolbox::benchmark::measure("adler32 (4 MiB)", 20, [&data]
+        {
+            toolbox::benchmark::keep(memory::adler32(data.data(), data.size()));
+        });
+    }
+}
+
+void toolbox::benchmark::runMemoryBenchmarks()
+{
+    benchmarkSlicing();
+    benchmarkByteOrderConversion();
+    benchmarkBitUnpacking<12>("unpackBits<12> (1M values)", "detail::unpackBitsScalar<12> (1M values)");
+    benchmarkBitUnpacking<20>("unpackBits<20> (1M values)", "detail::unpackBitsScalar<20> (1M values)");
+    benchmarkBitUnpacking<37>("unpackBits<37> (1M values)", "detail::unpackBitsScalar<37> (1M values)");
+    benchmarkVarintDecoding();
+    benchmarkBitWriting<toolbox::memory::bit_order_t::msb_first>("BitWriter<msb_first> mixed widths (1M values, ~1.1 MB)");
+    benchmarkBitWriting<toolbox::memory::bit_order_t::lsb_first>("BitWriter<lsb_first> mixed widths (1M values, ~1.1 MB)");
+    benchmarkChecksums();
+}
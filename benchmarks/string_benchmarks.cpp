@@ -0,0 +1,296 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "./benchmark.hpp"
+#include "../src/toolbox/string/transform.hpp"
+
+#include <charconv>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> makeDecimalFields(size_t count)
+    {
+        std::vector<std::string> fields;
+        uint64_t value{1};
+        for (size_t i = 0; i < count; ++i)
+        {
+            value = value * 6364136223846793005u + 1442695040888963407u;
+            fields.push_back(std::to_string(value >> (i % 64)));
+        }
+        return fields;
+    }
+
+    std::vector<std::string> makeHexFields(size_t count)
+    {
+        std::vector<std::string> fields;
+        uint64_t value{1};
+        for (size_t i = 0; i < count; ++i)
+        {
+            value = value * 6364136223846793005u + 1442695040888963407u;
+            std::array<char, 16> buffer{};
+            const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), (value >> (i % 64)) | 1u, 16);
+            fields.emplace_back(buffer.data(), result.ptr);
+        }
+        return fields;
+    }
+
+    void benchmarkDecimalParsing()
+    {
+        constexpr size_t fieldsCount = 4096;
+        const auto fields = makeDecimalFields(fieldsCount);
+        const auto hexFields = makeHexFields(fieldsCount);
+
+        toolbox::benchmark::measure("parseDecimal<uint64_t> (4096 fields)", 1000, [&fields]
+        {
+            uint64_t sum{0};
+            for (const auto &field : fields)
+            {
+                uint64_t value{0};
+                toolbox::string::parseDecimal(field, value);
+                sum += value;
+            }
+            toolbox::benchmark::keep(sum);
+        });
+
+        toolbox::benchmark::measure("std::from_chars<uint64_t> (4096 fields)", 1000, [&fields]
+        {
+            uint64_t sum{0};
+            for (const auto &field : fields)
+            {
+                uint64_t value{0};
+                std::from_chars(field.data(), field.data() + field.size(), value);
+                sum += value;
+            }
+            toolbox::benchmark::keep(sum);
+        });
+
+        toolbox::benchmark::measure("std::stoull (4096 fields)", 1000, [&fields]
+        {
+            uint64_t sum{0};
+            for (const auto &field : fields)
+            {
+                sum += std::stoull(field);
+            }
+            toolbox::benchmark::keep(sum);
+        });
+
+        toolbox::benchmark::measure("tryConvertHexString<uint64_t> (4096 fields)", 1000, [&hexFields]
+        {
+            uint64_t sum{0};
+            for (const auto &field : hexFields)
+            {
+                uint64_t value{0};
+                toolbox::string::tryConvertHexString(field, value);
+                sum += value;
+            }
+            toolbox::benchmark::keep(sum);
+        });
+
+        toolbox::benchmark::measure("convertHexString<uint64_t> (4096 fields)", 1000, [&hexFields]
+        {
+            uint64_t sum{0};
+            for (const auto &field : hexFields)
+            {
+                sum += toolbox::string::convertHexString<uint64_t>(field);
+            }
+            toolbox::benchmark::keep(sum);
+        });
+    }
+
+    void benchmarkDecimalFormatting()
+    {
+        constexpr size_t valuesCount = 4096;
+        std::vector<uint64_t> values;
+        uint64_t value{1};
+        for (size_t i = 0; i < valuesCount; ++i)
+        {
+            value = value * 6364136223846793005u + 1442695040888963407u;
+            values.push_back(value >> (i % 64));
+        }
+
+        toolbox::benchmark::measure("formatDecimal<uint64_t> (4096 values)", 1000, [&values]
+        {
+            std::array<char, toolbox::string::maxDecimalLength<uint64_t>> buffer{};
+            size_t length{0};
+            for (const auto current : values)
+            {
+                length += toolbox::string::formatDecimal(current, buffer.data());
+            }
+            toolbox::benchmark::keep(length);
+        });
+
+        toolbox::benchmark::measure("std::to_chars<uint64_t> (4096 values)", 1000, [&values]
+        {
+            std::array<char, toolbox::string::maxDecimalLength<uint64_t>> buffer{};
+            size_t length{0};
+            for (const auto current : values)
+            {
+                length += static_cast<size_t>(std::to_chars(buffer.data(), buffer.data() + buffer.size(), current).ptr - buffer.data());
+            }
+            toolbox::benchmark::keep(length);
+        });
+    }
+
+    void benchmarkHexDump()
+    {
+        std::vector<uint8_t> data(4 * 1024 * 1024);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 31);
+        }
+
+        toolbox::benchmark::measure("hexDump (4 MiB)", 20, [&data]
+        {
+            size_t length{0};
+            toolbox::string::hexDump(data.data(), data.size(), [&length](std::string_view block)
+            {
+                length += block.size();
+            });
+            toolbox::benchmark::keep(length);
+        });
+
+        std::string encoded(2 * data.size(), '?');
+        toolbox::benchmark::measure("encodeHex (4 MiB)", 20, [&data, &encoded]
+        {
+            toolbox::benchmark::keep(toolbox::string::encodeHex(data.data(), data.size(), encoded.data()));
+        });
+
+        toolbox::benchmark::measure("detail::encodeHexScalar (4 MiB)", 20, [&data, &encoded]
+        {
+            toolbox::string::detail::encodeHexScalar(data.data(), data.size(), encoded.data(), false);
+            toolbox::benchmark::keep(encoded[0]);
+        });
+    }
+
+    void benchmarkBase64()
+    {
+        std::vector<uint8_t> data(3 * 1024 * 1024);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 31 + i / 5);
+        }
+        std::string encoded(toolbox::string::base64EncodedLength(data.size()), '?');
+        std::vector<uint8_t> decoded(data.size());
+        const auto &alphabet = toolbox::string::detail::base64Alphabets[0];
+        const auto &values = toolbox::string::detail::base64Values[0];
+
+        toolbox::benchmark::measure("encodeBase64 (3 MiB)", 100, [&data, &encoded]
+        {
+            toolbox::benchmark::keep(toolbox::string::encodeBase64(data.data(), data.size(), encoded.data()));
+        });
+
+        toolbox::benchmark::measure("detail::encodeBase64GroupsScalar (3 MiB)", 100, [&data, &encoded, &alphabet]
+        {
+            toolbox::string::detail::encodeBase64GroupsScalar(data.data(), data.size() / 3, encoded.data(), alphabet);
+            toolbox::benchmark::keep(encoded[0]);
+        });
+
+        toolbox::benchmark::measure("decodeBase64 (4 MiB)", 100, [&encoded, &decoded]
+        {
+            size_t written{0};
+            toolbox::benchmark::keep(toolbox::string::decodeBase64(encoded, decoded.data(), written));
+        });
+
+        toolbox::benchmark::measure("detail::decodeBase64GroupsScalar (4 MiB)", 100, [&encoded, &decoded, &values]
+        {
+            toolbox::benchmark::keep(toolbox::string::detail::decodeBase64GroupsScalar(encoded.data(), encoded.size() / 4, decoded.data(), values));
+        });
+    }
+
+    void benchmarkUuid()
+    {
+        constexpr size_t uuidsCount = 4096;
+        std::vector<std::array<uint8_t, 16>> uuids(uuidsCount);
+        uint64_t value{1};
+        for (auto &uuid : uuids)
+        {
+            for (auto &byte : uuid)
+            {
+                value = value * 6364136223846793005u + 1442695040888963407u;
+                byte = static_cast<uint8_t>(value >> 56u);
+            }
+        }
+        std::vector<std::string> texts;
+        for (const auto &uuid : uuids)
+        {
+            std::string text(toolbox::string::uuidLength(), '?');
+            toolbox::string::formatUuid(uuid, text.data());
+            texts.push_back(text);
+        }
+
+        std::string formatted(uuidsCount * toolbox::string::uuidLength(), '?');
+        toolbox::benchmark::measure("formatUuid (4096 UUIDs)", 1000, [&uuids, &formatted]
+        {
+            char *current = formatted.data();
+            for (const auto &uuid : uuids)
+            {
+                current += toolbox::string::formatUuid(uuid, current);
+            }
+            toolbox::benchmark::keep(formatted[0]);
+        });
+
+        toolbox::benchmark::measure("detail::encodeUuidScalar (4096 UUIDs)", 1000, [&uuids, &formatted]
+        {
+            char *current = formatted.data();
+            for (const auto &uuid : uuids)
+            {
+                current += toolbox::string::detail::encodeUuidScalar(uuid, true, current);
+            }
+            toolbox::benchmark::keep(formatted[0]);
+        });
+
+        toolbox::benchmark::measure("parseUuid (4096 UUIDs)", 1000, [&texts]
+        {
+            std::array<uint8_t, 16> uuid{};
+            size_t sum{0};
+            for (const auto &text : texts)
+            {
+                sum += static_cast<size_t>(toolbox::string::parseUuid(text, uuid)) + uuid[15];
+            }
+            toolbox::benchmark::keep(sum);
+        });
+
+        toolbox::benchmark::measure("detail::decodeUuidScalar (4096 UUIDs)", 1000, [&texts]
+        {
+            std::array<uint8_t, 16> uuid{};
+            size_t sum{0};
+            for (const auto &text : texts)
+            {
+                sum += static_cast<size_t>(toolbox::string::detail::decodeUuidScalar(text, true, uuid)) + uuid[15];
+            }
+            toolbox::benchmark::keep(sum);
+        });
+    }
+}
+
+void toolbox::benchmark::runStringBenchmarks()
+{
+    benchmarkDecimalParsing();
+    benchmarkDecimalFormatting();
+    benchmarkHexDump();
+    benchmarkBase64();
+    benchmarkUuid();
+}
@@ -0,0 +1,216 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./simd_search.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+namespace toolbox::container
+{
+    /// Tag selecting overloads which put a blocked Bloom filter in front of the exact membership test, so elements absent
+    /// from a huge blacklist or whitelist are rejected with a single cache line read.
+    /// \example removeElements(bloom_filter, events, blacklist), containsAny(bloom_filter_t{0.001}, events, whitelist)
+    class bloom_filter_t
+    {
+    public:
+        /// Create the tag.
+        /// \param falsePositiveRate Wanted probability of passing an absent element to the exact test; the lower, the bigger the filter.
+        /// \throws If the \p falsePositiveRate isn't in (0, 1) range, \p std::invalid_argument exception is thrown.
+        explicit constexpr bloom_filter_t(double falsePositiveRate = 0.01)
+                : falsePositiveRate_{falsePositiveRate}
+        {
+            if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+            {
+                throw std::invalid_argument{"False positive rate of the Bloom filter has to be in (0, 1) range."};
+            }
+        }
+
+        /// Return wanted probability of passing an absent element to the exact test.
+        constexpr double falsePositiveRate() const noexcept
+        {
+            return falsePositiveRate_;
+        }
+
+    private:
+        double falsePositiveRate_;
+    };
+
+    /// Tag selecting overloads with Bloom filter of 1% false positive rate.
+    inline constexpr bloom_filter_t bloom_filter{};
+
+    namespace detail
+    {
+        /// Number of bits of a Bloom filter block: one cache line, set by a single element in each of its 64-bit words.
+        inline constexpr size_t bloomBlockBits = 512;
+
+        /// Most bits per element a Bloom filter uses; gives false positive rate about 1e-7.
+        inline constexpr size_t bloomMaxBitsPerElement = 64;
+
+        /// Odd multipliers deriving positions of the bits in the words of a block from the 32-bit part of the hash.
+        inline constexpr uint32_t bloomSalts[8] = {0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+                                                   0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+        struct alignas(64) bloom_block_t
+        {
+            uint64_t words[8]{};
+        };
+
+        /// Finalizer of SplitMix64; spreads the bits of std::hash results, which are identities for integers in common implementations.
+        constexpr uint64_t mixHash(uint64_t hash) noexcept
+        {
+            hash = (hash ^ (hash >> 30u)) * 0xbf58476d1ce4e5b9u;
+            hash = (hash ^ (hash >> 27u)) * 0x94d049bb133111ebu;
+            return hash ^ (hash >> 31u);
+        }
+
+        /// Expected false positive rate of blocked Bloom filter with \p bitsPerElement bits per element.
+        /// \remark Elements are spread over blocks unevenly, so the rate is averaged over Poisson distributed load of a block.
+        inline double bloomFalsePositiveRate(size_t bitsPerElement) noexcept
+        {
+            const double meanLoad = static_cast<double>(bloomBlockBits) / static_cast<double>(bitsPerElement);
+            const double lastLoad = meanLoad + 12.0 * std::sqrt(meanLoad) + 16.0;
+            double loadProbability = std::exp(-meanLoad);
+            double rate = 0.0;
+            for (double load = 0.0; load <= lastLoad; load += 1.0)
+            {
+                rate += loadProbability * std::pow(1.0 - std::pow(63.0 / 64.0, load), 8.0);
+                loadProbability *= meanLoad / (load + 1.0);
+            }
+            return rate;
+        }
+
+        /// Number of blocks of a filter for \p elementsCount elements and the wanted \p falsePositiveRate.
+        inline size_t bloomBlocksCount(size_t elementsCount, double falsePositiveRate) noexcept
+        {
+            size_t bitsPerElement = 1;
+            while (bitsPerElement < bloomMaxBitsPerElement && bloomFalsePositiveRate(bitsPerElement) > falsePositiveRate)
+            {
+                ++bitsPerElement;
+            }
+            return std::max<size_t>(1, (elementsCount * bitsPerElement + bloomBlockBits - 1) / bloomBlockBits);
+        }
+
+        inline bool probeBloomBlockScalar(const bloom_block_t &block, uint32_t hash) noexcept
+        {
+            uint64_t missing = 0;
+            for (size_t i = 0; i < 8; ++i)
+            {
+                missing |= ~block.words[i] & uint64_t{1} << (hash * bloomSalts[i] >> 26u);
+            }
+            return missing == 0;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Test all 8 bits of the block at once: 32-bit products of the salts give the positions, widened to 64-bit shifts.
+        __attribute__((target("avx2")))
+        inline bool probeBloomBlockAvx2(const bloom_block_t &block, uint32_t hash) noexcept
+        {
+            const __m256i salts = _mm256_setr_epi32(0x47b6137b, 0x44974d91, static_cast<int>(0x8824ad5bu), static_cast<int>(0xa2b7289du),
+                                                    0x705495c7, 0x2df1424b, static_cast<int>(0x9efc4947u), 0x5c6bfb31);
+            const __m256i positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(hash)), salts), 26);
+            const __m256i ones = _mm256_set1_epi64x(1);
+            const __m256i lowBits = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(positions)));
+            const __m256i highBits = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(positions, 1)));
+            const __m256i lowWords = _mm256_load_si256(reinterpret_cast<const __m256i *>(block.words));
+            const __m256i highWords = _mm256_load_si256(reinterpret_cast<const __m256i *>(block.words + 4));
+            return (_mm256_testc_si256(lowWords, lowBits) & _mm256_testc_si256(highWords, highBits)) != 0;
+        }
+#endif
+    }
+
+    /// Blocked Bloom filter: probabilistic set which answers "maybe present" or "surely absent", reading a single cache line.
+    /// \tparam T Type of the elements; std::hash<T> has to be available.
+    /// \remark Each element sets one bit in each of 8 words of a 64-byte block chosen by its hash. The size is derived
+    /// from the expected elements count and the wanted false positive rate.
+    template <class T>
+    class BlockedBloomFilter
+    {
+    public:
+        /// Create an empty filter.
+        /// \param expectedElementsCount Number of elements which will be inserted.
+        /// \param prefilter Tag carrying the wanted false positive rate.
+        BlockedBloomFilter(size_t expectedElementsCount, bloom_filter_t prefilter)
+                : blocks_(detail::bloomBlocksCount(expectedElementsCount, prefilter.falsePositiveRate()))
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+                , avx2_{detail::hasAvx2()}
+#endif
+        {
+        }
+
+        /// Add \p element to the filter.
+        void insert(const T &element)
+        {
+            const uint64_t hash = hashOf(element);
+            auto &block = blocks_[blockIndex(hash)];
+            for (size_t i = 0; i < 8; ++i)
+            {
+                block.words[i] |= uint64_t{1} << (static_cast<uint32_t>(hash) * detail::bloomSalts[i] >> 26u);
+            }
+        }
+
+        /// Test whether \p element may have been inserted; false means it surely wasn't.
+        bool mayContain(const T &element) const
+        {
+            const uint64_t hash = hashOf(element);
+            const auto &block = blocks_[blockIndex(hash)];
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (avx2_)
+            {
+                return detail::probeBloomBlockAvx2(block, static_cast<uint32_t>(hash));
+            }
+#endif
+            return detail::probeBloomBlockScalar(block, static_cast<uint32_t>(hash));
+        }
+
+        /// Return size of the filter in bytes.
+        size_t sizeInBytes() const noexcept
+        {
+            return blocks_.size() * sizeof(detail::bloom_block_t);
+        }
+
+    private:
+        static uint64_t hashOf(const T &element)
+        {
+            return detail::mixHash(std::hash<T>{}(element));
+        }
+
+        /// Map the upper half of the \p hash to a block without division.
+        size_t blockIndex(uint64_t hash) const noexcept
+        {
+            const uint64_t index = (hash >> 32u) * blocks_.size() >> 32u;
+            return index;
+        }
+
+        std::vector<detail::bloom_block_t> blocks_;
+        bool avx2_{false};
+    };
+}
@@ -0,0 +1,406 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./bloom_filter.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace toolbox::container
+{
+    /// Way of testing whether an element belongs to a collection.
+    enum class membership_strategy_t
+    {
+        linear, ///< std::find over the collection itself; no preparation, best for tiny inputs
+        bitmap, ///< one bit per value between the smallest and the largest element; integral types with small domain
+        hash,   ///< hash set of the elements; hashable types
+        sorted  ///< sorted elements and binary search; ordered types which aren't hashable
+    };
+
+    namespace detail
+    {
+        template <class T, class = void>
+        struct is_hashable : std::false_type
+        {
+        };
+
+        template <class T>
+        struct is_hashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>>
+                : std::is_default_constructible<std::hash<T>>
+        {
+        };
+
+        template <class T, class = void>
+        struct is_less_comparable : std::false_type
+        {
+        };
+
+        template <class T>
+        struct is_less_comparable<T, std::void_t<decltype(std::declval<const T &>() < std::declval<const T &>())>>
+                : std::true_type
+        {
+        };
+
+        /// Element stored in the index: scalars by value, other types by pointer to the indexed collection, so they aren't copied.
+        template <class T>
+        using membership_key_t = std::conditional_t<std::is_scalar<T>::value, T, const T *>;
+
+        template <class T>
+        constexpr membership_key_t<T> makeMembershipKey(const T &element) noexcept
+        {
+            if constexpr (std::is_scalar<T>::value)
+            {
+                return element;
+            }
+            else
+            {
+                return &element;
+            }
+        }
+
+        template <class T>
+        constexpr const T &membershipKeyValue(const membership_key_t<T> &key) noexcept
+        {
+            if constexpr (std::is_scalar<T>::value)
+            {
+                return key;
+            }
+            else
+            {
+                return *key;
+            }
+        }
+
+        template <class T>
+        struct membership_key_hash
+        {
+            size_t operator()(const membership_key_t<T> &key) const
+            {
+                return std::hash<T>{}(membershipKeyValue<T>(key));
+            }
+        };
+
+        template <class T>
+        struct membership_key_equal
+        {
+            bool operator()(const membership_key_t<T> &first, const membership_key_t<T> &second) const
+            {
+                return membershipKeyValue<T>(first) == membershipKeyValue<T>(second);
+            }
+        };
+
+        template <class T>
+        struct membership_key_less
+        {
+            bool operator()(const membership_key_t<T> &first, const membership_key_t<T> &second) const
+            {
+                return membershipKeyValue<T>(first) < membershipKeyValue<T>(second);
+            }
+        };
+
+        /// Number of elements of the \p container; doesn't require size(), so it works with std::forward_list too.
+        template <class Container>
+        size_t elementsCount(const Container &container)
+        {
+            return static_cast<size_t>(std::distance(container.cbegin(), container.cend()));
+        }
+
+        /// Check whether elements of \p SourceContainer can be looked up in MembershipIndex of \p IndexedContainer.
+        /// \remark Index is used only for the same element types, so no implicit conversion changes the comparison results.
+        template <class SourceContainer, class IndexedContainer>
+        inline constexpr bool is_indexable_lookup_v = std::is_same<std::remove_cv_t<typename SourceContainer::value_type>,
+                                                                   std::remove_cv_t<typename IndexedContainer::value_type>>::value;
+
+        /// Position of the integral \p value in the bitmap domain; wraps around, so it's monotonic for both signed and unsigned types.
+        template <class T>
+        constexpr uint64_t bitmapPosition(T value) noexcept
+        {
+            if constexpr (std::is_same<T, uint64_t>::value)
+            {
+                return value;
+            }
+            else
+            {
+                return static_cast<uint64_t>(value);
+            }
+        }
+
+        /// Up to this number of lookups or indexed elements the linear scan beats building of any index.
+        inline constexpr size_t linearLookupMaxCount = 8;
+
+        /// Up to this number of comparisons (lookups times indexed elements) the linear scan beats building of any index.
+        inline constexpr size_t linearComparisonsMaxCount = 1024;
+
+        /// Bitmap is used when it has at most this many bits per indexed element (or 64 Kibit in total).
+        inline constexpr uint64_t bitmapMaxBitsPerElement = 32;
+    }
+
+    /// Prepared collection of elements for fast membership testing, with strategy picked from sizes and element traits.
+    /// \tparam Container Indexed container type, should provide cbegin(), cend() and value_type.
+    /// \remark The indexed container has to outlive the index and stay unchanged; elements of non-scalar types
+    /// aren't copied into the index, it refers to them.
+    template <class Container>
+    class MembershipIndex
+    {
+    public:
+        using value_type = std::remove_cv_t<typename Container::value_type>;
+
+        /// Index \p elements, choosing the strategy best for the expected number of lookups.
+        /// \param elements Indexed elements.
+        /// \param expectedLookups How many times contains() will be called; tiny lookup counts don't pay off building an index.
+        MembershipIndex(const Container &elements, size_t expectedLookups)
+                : MembershipIndex{elements, detail::elementsCount(elements), expectedLookups}
+        {
+        }
+
+        /// Index \p elements with the given \p strategy.
+        /// \param elements Indexed elements.
+        /// \param strategy Strategy to be used; if it's not applicable for value_type or the elements (bitmap of too wide domain),
+        /// the next one of: bitmap, hash, sorted, linear is used.
+        MembershipIndex(const Container &elements, membership_strategy_t strategy)
+                : elements_{&elements}
+        {
+            build(strategy, detail::elementsCount(elements));
+        }
+
+        /// Index \p elements, choosing the strategy best for the expected number of lookups, and put a blocked Bloom filter
+        /// in front of the hash set or sorted array, so most absent elements are rejected with a single cache line read.
+        /// \param elements Indexed elements.
+        /// \param expectedLookups How many times contains() will be called; tiny lookup counts don't pay off building an index.
+        /// \param prefilter Tag carrying false positive rate of the filter.
+        /// \remark The filter is built only for hashable types and when the hash or sorted strategy is chosen - bitmap
+        /// lookups are already a single memory read.
+        MembershipIndex(const Container &elements, size_t expectedLookups, bloom_filter_t prefilter)
+                : MembershipIndex{elements, expectedLookups}
+        {
+            if constexpr (detail::is_hashable<value_type>::value)
+            {
+                if (strategy_ == membership_strategy_t::hash || strategy_ == membership_strategy_t::sorted)
+                {
+                    prefilter_.emplace(detail::elementsCount(elements), prefilter);
+                    for (const auto &element : elements)
+                    {
+                        prefilter_->insert(element);
+                    }
+                }
+            }
+        }
+
+        MembershipIndex(const MembershipIndex &) = default;
+        MembershipIndex(MembershipIndex &&) noexcept = default;
+        MembershipIndex &operator=(const MembershipIndex &) = default;
+        MembershipIndex &operator=(MembershipIndex &&) noexcept = default;
+        ~MembershipIndex() = default;
+
+        /// Test whether \p element is one of the indexed elements.
+        bool contains(const value_type &element) const
+        {
+            if constexpr (detail::is_hashable<value_type>::value)
+            {
+                if (prefilter_ && !prefilter_->mayContain(element))
+                {
+                    return false;
+                }
+            }
+            switch (strategy_)
+            {
+                case membership_strategy_t::bitmap:
+                    if constexpr (std::is_integral<value_type>::value)
+                    {
+                        const uint64_t offset = detail::bitmapPosition(element) - bitmapOffset_;
+                        return offset < bitmapBitsCount_ && (bitmap_[offset / 64] >> (offset % 64) & 1u) != 0;
+                    }
+                    break;
+                case membership_strategy_t::hash:
+                    if constexpr (detail::is_hashable<value_type>::value)
+                    {
+                        return hashed_.find(detail::makeMembershipKey(element)) != hashed_.cend();
+                    }
+                    break;
+                case membership_strategy_t::sorted:
+                    if constexpr (detail::is_less_comparable<value_type>::value)
+                    {
+                        return std::binary_search(sorted_.cbegin(), sorted_.cend(), detail::makeMembershipKey(element),
+                                                  detail::membership_key_less<value_type>{});
+                    }
+                    break;
+                case membership_strategy_t::linear:
+                    break;
+            }
+            return std::find(elements_->cbegin(), elements_->cend(), element) != elements_->cend();
+        }
+
+        /// Return the strategy used by the index.
+        membership_strategy_t strategy() const noexcept
+        {
+            return strategy_;
+        }
+
+        /// Check whether lookups go through a Bloom filter first.
+        bool prefiltered() const noexcept
+        {
+            return prefilter_.has_value();
+        }
+
+    private:
+        MembershipIndex(const Container &elements, size_t elementsCount, size_t expectedLookups)
+                : elements_{&elements}
+        {
+            build(chooseStrategy(elementsCount, expectedLookups), elementsCount);
+        }
+
+        static membership_strategy_t chooseStrategy(size_t elementsCount, size_t expectedLookups) noexcept
+        {
+            if (elementsCount <= detail::linearLookupMaxCount || expectedLookups <= detail::linearLookupMaxCount ||
+                elementsCount * expectedLookups <= detail::linearComparisonsMaxCount)
+            {
+                return membership_strategy_t::linear;
+            }
+            // build() falls back to the next strategy when bitmap isn't applicable:
+            return membership_strategy_t::bitmap;
+        }
+
+        /// Find domain of the elements and check whether its bitmap is small enough.
+        bool fitsBitmap(size_t elementsCount)
+        {
+            if constexpr (std::is_integral<value_type>::value)
+            {
+                if (elementsCount == 0)
+                {
+                    return false;
+                }
+                const auto bounds = std::minmax_element(elements_->cbegin(), elements_->cend());
+                const uint64_t range = detail::bitmapPosition(*bounds.second) - detail::bitmapPosition(*bounds.first);
+                if (range < std::max<uint64_t>(uint64_t{1} << 16u, detail::bitmapMaxBitsPerElement * elementsCount))
+                {
+                    bitmapOffset_ = detail::bitmapPosition(*bounds.first);
+                    bitmapBitsCount_ = range + 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void build(membership_strategy_t strategy, size_t elementsCount)
+        {
+            if (strategy == membership_strategy_t::bitmap && !fitsBitmap(elementsCount))
+            {
+                strategy = detail::is_hashable<value_type>::value ? membership_strategy_t::hash : membership_strategy_t::sorted;
+            }
+            if (strategy == membership_strategy_t::hash && !detail::is_hashable<value_type>::value)
+            {
+                strategy = membership_strategy_t::sorted;
+            }
+            if (strategy == membership_strategy_t::sorted && !detail::is_less_comparable<value_type>::value)
+            {
+                strategy = membership_strategy_t::linear;
+            }
+            strategy_ = strategy;
+
+            if (strategy == membership_strategy_t::bitmap)
+            {
+                if constexpr (std::is_integral<value_type>::value)
+                {
+                    const size_t wordsCount = (bitmapBitsCount_ + 63) / 64;
+                    bitmap_.assign(wordsCount, 0);
+                    for (const auto &element : *elements_)
+                    {
+                        const uint64_t offset = detail::bitmapPosition(element) - bitmapOffset_;
+                        bitmap_[offset / 64] |= uint64_t{1} << (offset % 64);
+                    }
+                }
+            }
+            else if (strategy == membership_strategy_t::hash)
+            {
+                if constexpr (detail::is_hashable<value_type>::value)
+                {
+                    hashed_.reserve(elementsCount);
+                    for (const auto &element : *elements_)
+                    {
+                        hashed_.insert(detail::makeMembershipKey(element));
+                    }
+                }
+            }
+            else if (strategy == membership_strategy_t::sorted)
+            {
+                if constexpr (detail::is_less_comparable<value_type>::value)
+                {
+                    sorted_.reserve(elementsCount);
+                    for (const auto &element : *elements_)
+                    {
+                        sorted_.push_back(detail::makeMembershipKey(element));
+                    }
+                    std::sort(sorted_.begin(), sorted_.end(), detail::membership_key_less<value_type>{});
+                }
+            }
+        }
+
+        using key_type = detail::membership_key_t<value_type>;
+
+        const Container *elements_;
+        membership_strategy_t strategy_{membership_strategy_t::linear};
+        uint64_t bitmapOffset_{0};
+        uint64_t bitmapBitsCount_{0};
+        std::vector<uint64_t> bitmap_{};
+        std::unordered_set<key_type, detail::membership_key_hash<value_type>, detail::membership_key_equal<value_type>> hashed_{};
+        std::vector<key_type> sorted_{};
+        std::optional<BlockedBloomFilter<value_type>> prefilter_{};
+    };
+
+    namespace detail
+    {
+        /// Call \p visitor with every element of \p source and whether it's one of the \p elements, indexing the \p elements
+        /// by MembershipIndex when the element types match.
+        /// \param visitor Callable taking an element of the \p source and the membership flag.
+        template <class SourceContainer, class ElementsContainer, class Visitor>
+        void visitMembership(const SourceContainer &source, const ElementsContainer &elements, Visitor &&visitor)
+        {
+            if constexpr (is_indexable_lookup_v<SourceContainer, ElementsContainer>)
+            {
+                const MembershipIndex<ElementsContainer> index{elements, elementsCount(source)};
+                for (const auto &element : source)
+                {
+                    visitor(element, index.contains(element));
+                }
+            }
+            else
+            {
+                for (const auto &element : source)
+                {
+                    visitor(element, std::find(elements.cbegin(), elements.cend(), element) != elements.cend());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace toolbox::container
+{
+    /// Tag selecting overloads which split the work across threads.
+    /// \example contains(parallel, hugeVector, value), contains(parallel_t{4}, hugeVector, value)
+    class parallel_t
+    {
+    public:
+        /// Create the tag.
+        /// \param threadsCount Maximal number of threads to be used, including the calling one; 0 means std::thread::hardware_concurrency().
+        explicit constexpr parallel_t(size_t threadsCount = 0) noexcept
+                : threadsCount_{threadsCount}
+        {
+        }
+
+        /// Return maximal number of threads to be used, including the calling one.
+        size_t threadsCount() const noexcept
+        {
+            if (threadsCount_ != 0)
+            {
+                return threadsCount_;
+            }
+            return std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+    private:
+        size_t threadsCount_;
+    };
+
+    /// Tag selecting overloads which split the work across all hardware threads.
+    inline constexpr parallel_t parallel{};
+
+    namespace detail
+    {
+        /// Minimal number of elements worth a separate thread; smaller ranges are processed by fewer threads.
+        inline constexpr size_t parallelMinElementsPerThread = 1 << 16;
+
+        /// Number of elements processed by a worker between checks whether another worker has already found a match.
+        inline constexpr size_t parallelBlockSize = 1 << 14;
+
+        /// Test whether \p blockTest is true for any block of [\p first, \p last), splitting the range into contiguous parts
+        /// checked block by block by separate threads (the calling thread checks the first part).
+        /// \remark Workers share an atomic flag, checked after every block of parallelBlockSize elements, so all of them stop
+        /// soon after any of them finds a match. The \p blockTest is called concurrently; if it throws, all workers are stopped
+        /// and joined, and the first exception (in order of the parts) is rethrown by the calling thread.
+        /// \param blockTest Callable taking the begin and end iterators of a block.
+        template <class Iterator, class BlockTest>
+        bool parallelAnyOfBlocks(parallel_t policy, Iterator first, Iterator last, const BlockTest &blockTest)
+        {
+            static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                          "'Iterator' should be random access iterator.");
+
+            const auto count = static_cast<size_t>(last - first);
+            const size_t threadsCount = std::min(policy.threadsCount(), count / parallelMinElementsPerThread);
+            if (threadsCount <= 1)
+            {
+                return blockTest(first, last);
+            }
+
+            std::atomic<bool> found{false};
+            std::vector<std::exception_ptr> failures(threadsCount);
+            const auto worker = [&found, &blockTest, &failures](size_t part, Iterator begin, Iterator end)
+            {
+                try
+                {
+                    while (begin != end && !found.load(std::memory_order_relaxed))
+                    {
+                        const auto blockEnd = begin + static_cast<typename std::iterator_traits<Iterator>::difference_type>(
+                                std::min(parallelBlockSize, static_cast<size_t>(end - begin)));
+                        if (blockTest(begin, blockEnd))
+                        {
+                            found.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+                        begin = blockEnd;
+                    }
+                }
+                catch (...)
+                {
+                    // stop the other workers; the exception is rethrown by the calling thread after joining all of them:
+                    failures[part] = std::current_exception();
+                    found.store(true, std::memory_order_relaxed);
+                }
+            };
+
+            const auto partBegin = [first, count, threadsCount](size_t part)
+            {
+                return first + static_cast<typename std::iterator_traits<Iterator>::difference_type>(count * part / threadsCount);
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(threadsCount - 1);
+            const auto joinWorkers = [&workers]
+            {
+                for (auto &thread : workers)
+                {
+                    thread.join();
+                }
+            };
+
+            try
+            {
+                for (size_t part = 1; part < threadsCount; ++part)
+                {
+                    workers.emplace_back(worker, part, partBegin(part), partBegin(part + 1));
+                }
+            }
+            catch (...)
+            {
+                // running workers have to be joined before the exception leaves, stop them as soon as possible:
+                found.store(true, std::memory_order_relaxed);
+                joinWorkers();
+                throw;
+            }
+
+            worker(0, first, partBegin(1));
+            joinWorkers();
+            for (const auto &failure : failures)
+            {
+                if (failure)
+                {
+                    std::rethrow_exception(failure);
+                }
+            }
+            return found.load(std::memory_order_relaxed);
+        }
+
+        /// Test whether \p predicate is true for any element of [\p first, \p last), splitting the work across threads
+        /// with parallelAnyOfBlocks.
+        template <class Iterator, class Predicate>
+        bool parallelAnyOf(parallel_t policy, Iterator first, Iterator last, const Predicate &predicate)
+        {
+            return parallelAnyOfBlocks(policy, first, last, [&predicate](Iterator begin, Iterator end)
+            {
+                return std::any_of(begin, end, predicate);
+            });
+        }
+    }
+}
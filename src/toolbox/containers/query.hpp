@@ -24,7 +24,14 @@
 
 #pragma once
 
+#include "./bloom_filter.hpp"
+#include "./membership.hpp"
+#include "./parallel.hpp"
+#include "./simd_search.hpp"
+#include "./sorted.hpp"
+
 #include <algorithm>
+#include <optional>
 
 namespace toolbox::container
 {
@@ -38,6 +45,8 @@ namespace toolbox::container
     /// \remark containsAny(empty, empty) == true
     /// \remark containsAny(not_empty, empty) == true
     /// \remark containsAny(empty, not_empty) == false
+    /// \remark For elements of the same type, the \p whitelist is indexed by MembershipIndex (bitmap, hash set or sorted array)
+    /// unless the inputs are tiny, so the test is O(n + m) or O(n log m) instead of O(n * m).
     template <class SourceContainer, class WhitelistContainer>
     constexpr bool containsAny(const SourceContainer& source, const WhitelistContainer& whitelist)
     {
@@ -56,6 +65,18 @@ namespace toolbox::container
             return false;
         }
 
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, WhitelistContainer>)
+        {
+            const MembershipIndex<WhitelistContainer> index{whitelist, detail::elementsCount(source)};
+            if (index.strategy() != membership_strategy_t::linear)
+            {
+                return std::any_of(source.cbegin(), source.cend(), [&index](const auto &elem)
+                {
+                    return index.contains(elem);
+                });
+            }
+        }
+
         return std::find_first_of(source.cbegin(), source.cend(), whitelist.cbegin(), whitelist.cend()) != source.cend();
     }
 
@@ -66,10 +87,40 @@ namespace toolbox::container
     /// \param element Value to be searched for.
     /// \return True if element is part of the \p source collection, false otherwise.
     /// \remark contains(empty, element) == false
+    /// \remark Contiguous containers of arithmetic types are searched with SIMD comparisons (AVX2 if the CPU supports it).
     template <class SourceContainer, class ElementType>
     constexpr bool contains(const SourceContainer& source, const ElementType& element)
     {
-        return std::find(source.cbegin(), source.cend(), element) != source.cend();
+        if constexpr (detail::is_simd_searchable_v<SourceContainer, ElementType>)
+        {
+            return detail::findEqualElement(source, element) != source.size();
+        }
+        else
+        {
+            return std::find(source.cbegin(), source.cend(), element) != source.cend();
+        }
+    }
+
+    /// Find position of the first occurrence of \p element in \p source collection.
+    /// \tparam SourceContainer Source container type.
+    /// \tparam ElementType Search element type.
+    /// \param source Source container to be searched.
+    /// \param element Value to be searched for.
+    /// \return Index of the first element equal to \p element, or std::nullopt if there is none.
+    /// \remark Contiguous containers of arithmetic types are searched with SIMD comparisons (AVX2 if the CPU supports it).
+    template <class SourceContainer, class ElementType>
+    std::optional<size_t> findIndex(const SourceContainer& source, const ElementType& element)
+    {
+        if constexpr (detail::is_simd_searchable_v<SourceContainer, ElementType>)
+        {
+            const size_t index = detail::findEqualElement(source, element);
+            return index != source.size() ? std::optional<size_t>{index} : std::nullopt;
+        }
+        else
+        {
+            const auto found = std::find(source.cbegin(), source.cend(), element);
+            return found != source.cend() ? std::optional<size_t>{static_cast<size_t>(std::distance(source.cbegin(), found))} : std::nullopt;
+        }
     }
 
 
@@ -82,6 +133,8 @@ namespace toolbox::container
     /// \remark containsOnly(empty, empty) == true
     /// \remark containsOnly(not_empty, empty) == false
     /// \remark containsOnly(empty, not_empty) == false
+    /// \remark For elements of the same type, the \p whitelist is indexed by MembershipIndex (bitmap, hash set or sorted array)
+    /// unless the inputs are tiny, so the test is O(n + m) or O(n log m) instead of O(n * m).
     template <class SourceContainer, class WhitelistContainer>
     constexpr bool containsOnly(const SourceContainer& source, const WhitelistContainer& whitelist)
     {
@@ -100,6 +153,18 @@ namespace toolbox::container
             return false;
         }
 
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, WhitelistContainer>)
+        {
+            const MembershipIndex<WhitelistContainer> index{whitelist, detail::elementsCount(source)};
+            if (index.strategy() != membership_strategy_t::linear)
+            {
+                return std::all_of(source.cbegin(), source.cend(), [&index](const auto &elem)
+                {
+                    return index.contains(elem);
+                });
+            }
+        }
+
         for (const auto &elem : source)
         {
             if(!contains(whitelist, elem))
@@ -110,4 +175,202 @@ namespace toolbox::container
 
         return true;
     }
-}
\ No newline at end of file
+
+    /// Test whether sorted \p source collection contains any of the elements from sorted \p whitelist collection.
+    /// \tparam SourceContainer Source container type, sorted in ascending order.
+    /// \tparam WhitelistContainer Whitelist container type, sorted in ascending order.
+    /// \param source Source container to be tested.
+    /// \param whitelist Whitelist elements to be searched for.
+    /// \return True if \p source contains any element from the \p whitelist collection, false otherwise.
+    /// \remark Corner cases are the same as for the unsorted containsAny.
+    /// \remark The inputs are merged until the first common element is found; the much longer one (if random access)
+    /// is galloped through with exponential search. Contiguous 32-bit integers are compared 4x4 at once with SSE2.
+    template <class SourceContainer, class WhitelistContainer>
+    bool containsAny(sorted_range_t, const SourceContainer& source, const WhitelistContainer& whitelist)
+    {
+        if (whitelist.empty() || source.empty())
+        {
+            return whitelist.empty() && source.empty();
+        }
+
+#if defined(__SSE2__)
+        if constexpr (detail::is_simd_intersectable_v<SourceContainer, WhitelistContainer>)
+        {
+            if (!detail::shouldGallop(source, whitelist) && !detail::shouldGallop(whitelist, source))
+            {
+                return detail::sortedIntersectSimd(source.data(), source.size(), whitelist.data(), whitelist.size());
+            }
+        }
+#endif
+
+        if (detail::shouldGallop(whitelist, source))
+        {
+            return detail::sortedIntersect(whitelist.cbegin(), whitelist.cend(), source.cbegin(), source.cend(), true);
+        }
+        return detail::sortedIntersect(source.cbegin(), source.cend(), whitelist.cbegin(), whitelist.cend(),
+                                       detail::shouldGallop(source, whitelist));
+    }
+
+    /// Test whether sorted \p source collection contains only elements from sorted \p whitelist collection.
+    /// \tparam SourceContainer Source container type, sorted in ascending order.
+    /// \tparam WhitelistContainer Whitelist container type, sorted in ascending order.
+    /// \param source Source container to be tested.
+    /// \param whitelist Whitelist elements to be searched for.
+    /// \return True if \p source contains only elements from the \p whitelist collection, false otherwise.
+    /// \remark Corner cases are the same as for the unsorted containsOnly.
+    /// \remark Linear-time subset test merging both inputs; the much longer \p whitelist (if random access) is galloped through.
+    template <class SourceContainer, class WhitelistContainer>
+    bool containsOnly(sorted_range_t, const SourceContainer& source, const WhitelistContainer& whitelist)
+    {
+        if (whitelist.empty() || source.empty())
+        {
+            return whitelist.empty() && source.empty();
+        }
+
+        const bool galloping = detail::shouldGallop(source, whitelist);
+        auto allowed = whitelist.cbegin();
+        for (const auto &elem : source)
+        {
+            allowed = detail::advanceLowerBound(allowed, whitelist.cend(), elem, galloping);
+            if (allowed == whitelist.cend() || elem < *allowed)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Test whether \p source collection contains \p element, splitting the search across threads.
+    /// \tparam SourceContainer Source container type; containers without random access iterators are searched sequentially.
+    /// \tparam ElementType Search element type.
+    /// \param policy Parallel execution tag, with optional limit of threads.
+    /// \param source Source container to be tested.
+    /// \param element Value to be searched for.
+    /// \return True if element is part of the \p source collection, false otherwise.
+    /// \remark Worth it for containers of millions of elements; smaller ones are searched by fewer threads or sequentially.
+    /// All threads stop soon after any of them finds the \p element.
+    template <class SourceContainer, class ElementType>
+    bool contains(parallel_t policy, const SourceContainer& source, const ElementType& element)
+    {
+        if constexpr (detail::is_simd_searchable_v<SourceContainer, ElementType>)
+        {
+            std::remove_cv_t<typename SourceContainer::value_type> searched{};
+            if (!detail::convertSearchedValue(element, searched))
+            {
+                return false;
+            }
+
+            // each block is searched with SIMD comparisons:
+            const auto *data = source.data();
+            return detail::parallelAnyOfBlocks(policy, data, data + source.size(), [searched](const auto *begin, const auto *end)
+            {
+                const auto count = static_cast<size_t>(end - begin);
+                return detail::findEqual(begin, count, searched) != count;
+            });
+        }
+        else if constexpr (detail::is_random_access_v<typename SourceContainer::const_iterator>)
+        {
+            return detail::parallelAnyOf(policy, source.cbegin(), source.cend(), [&element](const auto &elem)
+            {
+                return elem == element;
+            });
+        }
+        else
+        {
+            return contains(source, element);
+        }
+    }
+
+    /// Test whether \p source collection contains any of the elements from \p whitelist collection, splitting the search across threads.
+    /// \tparam SourceContainer Source container type; containers without random access iterators are searched sequentially.
+    /// \tparam WhitelistContainer Whitelist container type.
+    /// \param policy Parallel execution tag, with optional limit of threads.
+    /// \param source Source container to be tested.
+    /// \param whitelist Whitelist elements to be searched for.
+    /// \return True if \p source contains any element from the \p whitelist collection, false otherwise.
+    /// \remark Corner cases are the same as for the sequential containsAny.
+    /// \remark The \p whitelist is indexed once (see MembershipIndex) and shared by all threads, which stop soon after
+    /// any of them finds a match.
+    template <class SourceContainer, class WhitelistContainer>
+    bool containsAny(parallel_t policy, const SourceContainer& source, const WhitelistContainer& whitelist)
+    {
+        if (whitelist.empty() || source.empty())
+        {
+            return whitelist.empty() && source.empty();
+        }
+
+        if constexpr (!detail::is_random_access_v<typename SourceContainer::const_iterator>)
+        {
+            return containsAny(source, whitelist);
+        }
+        else if constexpr (detail::is_indexable_lookup_v<SourceContainer, WhitelistContainer>)
+        {
+            const MembershipIndex<WhitelistContainer> index{whitelist, detail::elementsCount(source)};
+            return detail::parallelAnyOf(policy, source.cbegin(), source.cend(), [&index](const auto &elem)
+            {
+                return index.contains(elem);
+            });
+        }
+        else
+        {
+            return detail::parallelAnyOf(policy, source.cbegin(), source.cend(), [&whitelist](const auto &elem)
+            {
+                return std::find(whitelist.cbegin(), whitelist.cend(), elem) != whitelist.cend();
+            });
+        }
+    }
+
+    /// Test whether \p source collection contains any of the elements from a huge \p whitelist collection, which most
+    /// of the tested elements are absent from.
+    /// \tparam SourceContainer Source container type.
+    /// \tparam WhitelistContainer Whitelist container type.
+    /// \param prefilter Tag carrying false positive rate of the Bloom filter.
+    /// \param source Source container to be tested.
+    /// \param whitelist Whitelist elements to be searched for.
+    /// \return True if \p source contains any element from the \p whitelist collection, false otherwise.
+    /// \remark Corner cases are the same as for containsAny without the filter.
+    /// \remark The \p whitelist is indexed by MembershipIndex with a blocked Bloom filter in front of it (for elements
+    /// of the same, hashable type), so an absent element usually costs a single cache line read.
+    template <class SourceContainer, class WhitelistContainer>
+    bool containsAny(bloom_filter_t prefilter, const SourceContainer& source, const WhitelistContainer& whitelist)
+    {
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, WhitelistContainer>)
+        {
+            if (!whitelist.empty() && !source.empty())
+            {
+                const MembershipIndex<WhitelistContainer> index{whitelist, detail::elementsCount(source), prefilter};
+                return std::any_of(source.cbegin(), source.cend(), [&index](const auto &elem)
+                {
+                    return index.contains(elem);
+                });
+            }
+        }
+        return containsAny(source, whitelist);
+    }
+
+    /// Test whether \p source collection contains only elements from a huge \p whitelist collection, rejecting the
+    /// elements absent from it with a Bloom filter.
+    /// \tparam SourceContainer Source container type.
+    /// \tparam WhitelistContainer Whitelist container type.
+    /// \param prefilter Tag carrying false positive rate of the Bloom filter.
+    /// \param source Source container to be tested.
+    /// \param whitelist Whitelist elements to be searched for.
+    /// \return True if \p source contains only elements from the \p whitelist collection, false otherwise.
+    /// \remark Corner cases are the same as for containsOnly without the filter.
+    template <class SourceContainer, class WhitelistContainer>
+    bool containsOnly(bloom_filter_t prefilter, const SourceContainer& source, const WhitelistContainer& whitelist)
+    {
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, WhitelistContainer>)
+        {
+            if (!whitelist.empty() && !source.empty())
+            {
+                const MembershipIndex<WhitelistContainer> index{whitelist, detail::elementsCount(source), prefilter};
+                return std::all_of(source.cbegin(), source.cend(), [&index](const auto &elem)
+                {
+                    return index.contains(elem);
+                });
+            }
+        }
+        return containsOnly(source, whitelist);
+    }
+}
@@ -24,12 +24,144 @@
 
 #pragma once
 
+#include "./membership.hpp"
+#include "./sorted.hpp"
+
 #include <string>
 #include <algorithm>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace toolbox::container
 {
+    /// Order of elements after in-place partitioning.
+    enum class partition_order_t
+    {
+        stable,  ///< relative order of both kept and removed elements is preserved (std::stable_partition, may allocate a buffer)
+        unstable ///< elements are swapped between the groups, any order (std::partition, no allocation)
+    };
+
+    namespace detail
+    {
+        template <class Container, class = void>
+        struct has_reserve : std::false_type
+        {
+        };
+
+        template <class Container>
+        struct has_reserve<Container, std::void_t<decltype(std::declval<Container &>().reserve(size_t{}))>> : std::true_type
+        {
+        };
+
+        template <class Container, class = void>
+        struct has_remove_if : std::false_type
+        {
+        };
+
+        template <class Container>
+        struct has_remove_if<Container, std::void_t<decltype(std::declval<Container &>().remove_if(
+                std::declval<bool (*)(const typename Container::value_type &)>()))>> : std::true_type
+        {
+        };
+
+        /// Check whether \p Container has member remove() taking exactly the \p Element type (no conversion changing the comparison).
+        template <class Container, class Element, class = void>
+        struct has_remove : std::false_type
+        {
+        };
+
+        template <class Container, class Element>
+        struct has_remove<Container, Element, std::void_t<decltype(std::declval<Container &>().remove(std::declval<const Element &>()))>>
+                : std::is_same<std::remove_cv_t<Element>, typename Container::value_type>
+        {
+        };
+
+        /// Reserve room for \p count elements in containers which support it (contiguous ones).
+        template <class Container>
+        void reserveElements(Container &container, size_t count)
+        {
+            if constexpr (has_reserve<Container>::value)
+            {
+                container.reserve(count);
+            }
+        }
+
+        /// Give back the memory reserved by reserveElements when \p container ended up holding less than a quarter of it,
+        /// so a mostly emptied result doesn't pin the capacity of its whole source.
+        template <class Container>
+        void releaseExcessCapacity(Container &container)
+        {
+            if constexpr (has_reserve<Container>::value)
+            {
+                if (container.size() < container.capacity() / 4)
+                {
+                    container.shrink_to_fit();
+                }
+            }
+        }
+
+        /// Erase elements of \p container satisfying the \p predicate. Node based containers (std::list, std::forward_list)
+        /// unlink the nodes with their remove_if, without moving any element; others use erase-remove idiom.
+        template <class Container, class Predicate>
+        void eraseElementsIf(Container &container, const Predicate &predicate)
+        {
+            if constexpr (has_remove_if<Container>::value)
+            {
+                container.remove_if(predicate);
+            }
+            else
+            {
+                container.erase(std::remove_if(container.begin(), container.end(), predicate), container.end());
+            }
+        }
+
+        /// Up to this number of elements, removeDuplicatesInPlace compares each element with the kept ones instead of hashing.
+        inline constexpr size_t deduplicationLinearMaxCount = 16;
+
+        /// Open addressing hash set of pointers to elements, with linear probing. Sized once for the given number of elements
+        /// (at most half full), so inserting doesn't allocate.
+        template <class T>
+        class DeduplicationTable
+        {
+        public:
+            explicit DeduplicationTable(size_t elementsCount)
+                    : slots_(capacityFor(elementsCount), nullptr)
+            {
+            }
+
+            /// Return the slot referring to an element equal to \p element, or the empty slot where it belongs.
+            const T *&slot(const T &element)
+            {
+                const size_t mask = slots_.size() - 1;
+                size_t position = hashOf(element) & mask;
+                while (slots_[position] != nullptr && !(*slots_[position] == element))
+                {
+                    position = (position + 1) & mask;
+                }
+                return slots_[position];
+            }
+
+        private:
+            static size_t capacityFor(size_t elementsCount) noexcept
+            {
+                size_t capacity = 16;
+                while (capacity < elementsCount * 2)
+                {
+                    capacity *= 2;
+                }
+                return capacity;
+            }
+
+            static size_t hashOf(const T &element)
+            {
+                const uint64_t hash = mixHash(std::hash<T>{}(element));
+                return hash;
+            }
+
+            std::vector<const T *> slots_;
+        };
+    }
 
     /// Remove from the \p source container all occurrences of any elements given in \p elementsToRemove.
     /// \tparam SourceContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
@@ -37,15 +169,64 @@ namespace toolbox::container
     /// \param source Source container to remove elements from. It won't be changed in any way.
     /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
     /// \return New \p SourceContainer object based on \p source with removed all unwanted elements.
+    /// \remark For elements of the same type, the blacklist is indexed once by MembershipIndex (bitmap, hash set or sorted array)
+    /// unless the inputs are tiny, so the removal is O(n + m) or O(n log m) instead of O(n * m).
+    /// \remark Contiguous results (std::vector, std::string) reserve size of the \p source up front - an upper bound
+    /// which avoids both reallocations and the second pass over the (possibly expensive) blacklist lookups.
+    /// If less than a quarter of that capacity gets used, the result is shrunk to fit: one more allocation and copy
+    /// of the kept elements, paid only when they are few, instead of holding memory for the whole \p source.
     template <class SourceContainer, class BlacklistContainer>
     constexpr SourceContainer removeElements(const SourceContainer& source, const BlacklistContainer& elementsToRemove)
     {
         SourceContainer wantedElements;
-        std::copy_if(source.cbegin(), source.cend(), std::back_inserter(wantedElements), [&elementsToRemove](
-                const auto currentElement)
+        detail::reserveElements(wantedElements, source.size());
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, BlacklistContainer>)
         {
-            return std::find(elementsToRemove.cbegin(), elementsToRemove.cend(), currentElement) == elementsToRemove.end();
-        });
+            const MembershipIndex<BlacklistContainer> index{elementsToRemove, detail::elementsCount(source)};
+            std::copy_if(source.cbegin(), source.cend(), std::back_inserter(wantedElements), [&index](
+                    const auto &currentElement)
+            {
+                return !index.contains(currentElement);
+            });
+        }
+        else
+        {
+            std::copy_if(source.cbegin(), source.cend(), std::back_inserter(wantedElements), [&elementsToRemove](
+                    const auto &currentElement)
+            {
+                return std::find(elementsToRemove.cbegin(), elementsToRemove.cend(), currentElement) == elementsToRemove.cend();
+            });
+        }
+        detail::releaseExcessCapacity(wantedElements);
+        return wantedElements;
+    }
+
+    /// Remove from the sorted \p source container all occurrences of any elements given in sorted \p elementsToRemove.
+    /// \tparam SourceContainer Some container type, sorted in ascending order, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam BlacklistContainer Some container type, sorted in ascending order, should provide cbegin(), cend().
+    /// \param source Source container to remove elements from. It won't be changed in any way.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \return New \p SourceContainer object based on \p source with removed all unwanted elements.
+    /// \remark Unlike std::set_difference, all occurrences of the blacklisted elements are removed, as in the unsorted removeElements.
+    /// \remark Linear-time merge of both inputs; the much longer blacklist (if random access) is galloped through.
+    /// \remark Contiguous results reserve the size of the \p source and are shrunk to fit when mostly empty, as in removeElements.
+    template <class SourceContainer, class BlacklistContainer>
+    SourceContainer removeElements(sorted_range_t, const SourceContainer& source, const BlacklistContainer& elementsToRemove)
+    {
+        SourceContainer wantedElements;
+        detail::reserveElements(wantedElements, source.size());
+        const bool galloping = detail::shouldGallop(source, elementsToRemove);
+        auto blacklisted = elementsToRemove.cbegin();
+        auto inserter = std::back_inserter(wantedElements);
+        for (const auto &currentElement : source)
+        {
+            blacklisted = detail::advanceLowerBound(blacklisted, elementsToRemove.cend(), currentElement, galloping);
+            if (blacklisted == elementsToRemove.cend() || currentElement < *blacklisted)
+            {
+                *inserter++ = currentElement;
+            }
+        }
+        detail::releaseExcessCapacity(wantedElements);
         return wantedElements;
     }
 
@@ -55,12 +236,22 @@ namespace toolbox::container
     /// \param source Source container to remove elements from. It won't be changed in any way.
     /// \param elementToRemove An element which should be removed.
     /// \return New \p SourceContainer object based on \p source with removed all unwanted elements.
+    /// \remark Contiguous results (std::vector, std::string) count the kept elements first and reserve exactly that much,
+    /// so they are built with a single allocation.
     template <class SourceContainer, class Element>
     constexpr SourceContainer removeElement(const SourceContainer& source, const Element& elementToRemove)
     {
         SourceContainer wantedElements;
+        if constexpr (detail::has_reserve<SourceContainer>::value)
+        {
+            const auto wantedCount = std::count_if(source.cbegin(), source.cend(), [&elementToRemove](const auto &currentElement)
+            {
+                return currentElement != elementToRemove;
+            });
+            wantedElements.reserve(static_cast<size_t>(wantedCount));
+        }
         std::copy_if(source.cbegin(), source.cend(), std::back_inserter(wantedElements), [&elementToRemove](
-                const auto currentElement)
+                const auto &currentElement)
         {
             return currentElement != elementToRemove;
         });
@@ -75,7 +266,22 @@ namespace toolbox::container
     template <class SourceContainer, class Element>
     constexpr void removeElementInPlace(SourceContainer& source, const Element& elementToRemove)
     {
-        source.erase(std::remove(source.begin(), source.end(), elementToRemove), source.end());
+        if constexpr (detail::has_remove<SourceContainer, Element>::value)
+        {
+            // member remove of std::list and std::forward_list handles elementToRemove referring to an element of the source:
+            source.remove(elementToRemove);
+        }
+        else if constexpr (detail::has_remove_if<SourceContainer>::value)
+        {
+            source.remove_if([&elementToRemove](const auto &currentElement)
+            {
+                return currentElement == elementToRemove;
+            });
+        }
+        else
+        {
+            source.erase(std::remove(source.begin(), source.end(), elementToRemove), source.end());
+        }
     }
 
     /// Remove in-place from the \p source container all occurrences of of any elements given in \p elementsToRemove.
@@ -83,13 +289,284 @@ namespace toolbox::container
     /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
     /// \param source Source container to remove elements from. It will be modified if contains any the \p elementsToRemove.
     /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \remark For elements of the same type, the blacklist is indexed once by MembershipIndex (bitmap, hash set or sorted array)
+    /// unless the inputs are tiny, so the removal is O(n + m) or O(n log m) instead of O(n * m).
     template <class SourceContainer, class BlacklistContainer>
     constexpr void removeElementsInPlace(SourceContainer& source, const BlacklistContainer& elementsToRemove)
     {
-        source.erase(std::remove_if(source.begin(), source.end(),
-                                    [elementsToRemove](const auto currentElement)
-                                    {
-                                        return std::find(elementsToRemove.cbegin(), elementsToRemove.cend(), currentElement) != elementsToRemove.cend();
-                                    }), source.end());
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, BlacklistContainer>)
+        {
+            if (static_cast<const void *>(&source) == static_cast<const void *>(&elementsToRemove))
+            {
+                // every element is blacklisted; the index can't refer to the elements being moved around:
+                source.clear();
+                return;
+            }
+
+            const MembershipIndex<BlacklistContainer> index{elementsToRemove, detail::elementsCount(source)};
+            detail::eraseElementsIf(source, [&index](const auto &currentElement)
+            {
+                return index.contains(currentElement);
+            });
+        }
+        else
+        {
+            detail::eraseElementsIf(source, [&elementsToRemove](const auto &currentElement)
+            {
+                return std::find(elementsToRemove.cbegin(), elementsToRemove.cend(), currentElement) != elementsToRemove.cend();
+            });
+        }
+    }
+
+    /// Remove from the \p source container all occurrences of any elements given in a huge \p elementsToRemove, which most
+    /// of the source elements are absent from.
+    /// \tparam SourceContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
+    /// \param prefilter Tag carrying false positive rate of the Bloom filter.
+    /// \param source Source container to remove elements from. It won't be changed in any way.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \return New \p SourceContainer object based on \p source with removed all unwanted elements.
+    /// \remark The blacklist is indexed by MembershipIndex with a blocked Bloom filter in front of it (for elements of the same,
+    /// hashable type), so a kept element usually costs a single cache line read instead of a hash set lookup.
+    /// \remark Contiguous results reserve the size of the \p source and are shrunk to fit when mostly empty, as in removeElements.
+    template <class SourceContainer, class BlacklistContainer>
+    SourceContainer removeElements(bloom_filter_t prefilter, const SourceContainer& source, const BlacklistContainer& elementsToRemove)
+    {
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, BlacklistContainer>)
+        {
+            SourceContainer wantedElements;
+            detail::reserveElements(wantedElements, source.size());
+            const MembershipIndex<BlacklistContainer> index{elementsToRemove, detail::elementsCount(source), prefilter};
+            std::copy_if(source.cbegin(), source.cend(), std::back_inserter(wantedElements), [&index](
+                    const auto &currentElement)
+            {
+                return !index.contains(currentElement);
+            });
+            detail::releaseExcessCapacity(wantedElements);
+            return wantedElements;
+        }
+        else
+        {
+            return removeElements(source, elementsToRemove);
+        }
+    }
+
+    /// Remove in-place from the \p source container all occurrences of any elements given in a huge \p elementsToRemove,
+    /// which most of the source elements are absent from.
+    /// \tparam SourceContainer Some container type, should provide begin(), end().
+    /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
+    /// \param prefilter Tag carrying false positive rate of the Bloom filter.
+    /// \param source Source container to remove elements from. It will be modified if contains any the \p elementsToRemove.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    template <class SourceContainer, class BlacklistContainer>
+    void removeElementsInPlace(bloom_filter_t prefilter, SourceContainer& source, const BlacklistContainer& elementsToRemove)
+    {
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, BlacklistContainer>)
+        {
+            if (static_cast<const void *>(&source) != static_cast<const void *>(&elementsToRemove))
+            {
+                const MembershipIndex<BlacklistContainer> index{elementsToRemove, detail::elementsCount(source), prefilter};
+                detail::eraseElementsIf(source, [&index](const auto &currentElement)
+                {
+                    return index.contains(currentElement);
+                });
+                return;
+            }
+        }
+        removeElementsInPlace(source, elementsToRemove);
+    }
+
+    /// Remove in-place from the \p source container all repeated occurrences of its elements, keeping the first ones
+    /// in their original order.
+    /// \tparam SourceContainer Some container type, should provide begin(), end() and erase(first, last) or remove_if().
+    /// \param source Source container to remove duplicates from.
+    /// \remark Elements are compared with operator==. Hashable elements are looked up in an open addressing table sized
+    /// once for the whole input, which refers to the kept elements instead of copying them - there is a single allocation,
+    /// not one per element. Up to deduplicationLinearMaxCount elements, and for types which aren't hashable, each element
+    /// is compared with all the kept ones instead.
+    /// \remark Random access containers move the kept elements to the front and erase the tail; node based ones
+    /// (std::list, std::forward_list) unlink the duplicates, so the kept elements aren't moved at all.
+    /// \example removeDuplicatesInPlace(ids) for ids == {7, 3, 7, 1, 3} changes ids to {7, 3, 1}.
+    template <class SourceContainer>
+    void removeDuplicatesInPlace(SourceContainer& source)
+    {
+        using value_type = typename SourceContainer::value_type;
+        const size_t count = detail::elementsCount(source);
+        constexpr bool hashable = detail::is_hashable<value_type>::value;
+
+        if constexpr (detail::is_random_access_v<typename SourceContainer::iterator>)
+        {
+            auto kept = source.begin();
+            const auto keep = [&kept](auto current)
+            {
+                if (kept != current)
+                {
+                    *kept = std::move(*current);
+                }
+                ++kept;
+            };
+
+            if (!hashable || count <= detail::deduplicationLinearMaxCount)
+            {
+                for (auto current = source.begin(); current != source.end(); ++current)
+                {
+                    if (std::find(source.begin(), kept, *current) == kept)
+                    {
+                        keep(current);
+                    }
+                }
+            }
+            else if constexpr (hashable)
+            {
+                detail::DeduplicationTable<value_type> table{count};
+                for (auto current = source.begin(); current != source.end(); ++current)
+                {
+                    auto &slot = table.slot(*current);
+                    if (slot == nullptr)
+                    {
+                        slot = &*kept;
+                        keep(current);
+                    }
+                }
+            }
+            source.erase(kept, source.end());
+        }
+        else if constexpr (hashable)
+        {
+            detail::DeduplicationTable<value_type> table{count};
+            detail::eraseElementsIf(source, [&table](const value_type &currentElement)
+            {
+                auto &slot = table.slot(currentElement);
+                if (slot != nullptr)
+                {
+                    return true;
+                }
+                slot = &currentElement;
+                return false;
+            });
+        }
+        else
+        {
+            std::vector<const value_type *> keptElements;
+            detail::eraseElementsIf(source, [&keptElements](const value_type &currentElement)
+            {
+                const bool repeated = std::any_of(keptElements.cbegin(), keptElements.cend(), [&currentElement](const value_type *kept)
+                {
+                    return *kept == currentElement;
+                });
+                if (!repeated)
+                {
+                    keptElements.push_back(&currentElement);
+                }
+                return repeated;
+            });
+        }
+    }
+
+    /// Remove from the \p source container all occurrences of any elements given in \p elementsToRemove, reusing the \p source.
+    /// \tparam SourceContainer Some container type, should provide begin(), end().
+    /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
+    /// \param source Temporary source container to remove elements from; the result is built from its storage.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \return The \p source with removed all unwanted elements.
+    /// \remark Nothing is allocated nor copied: node based containers keep the nodes of the wanted elements (only the unwanted
+    /// ones are unlinked), contiguous ones compact the wanted elements in their buffer.
+    template <class SourceContainer, class BlacklistContainer,
+              std::enable_if_t<!std::is_lvalue_reference<SourceContainer>::value && !std::is_const<SourceContainer>::value, int> = 0>
+    SourceContainer removeElements(SourceContainer&& source, const BlacklistContainer& elementsToRemove)
+    {
+        removeElementsInPlace(source, elementsToRemove);
+        return std::move(source);
+    }
+
+    /// Remove from the \p source container all occurrences of the element given in \p elementToRemove, reusing the \p source.
+    /// \tparam SourceContainer Some container type, should provide begin(), end().
+    /// \tparam Element An element type, should be compatible with elements in container and provides == operator.
+    /// \param source Temporary source container to remove elements from; the result is built from its storage.
+    /// \param elementToRemove An element which should be removed.
+    /// \return The \p source with removed all unwanted elements.
+    /// \remark Nothing is allocated nor copied: node based containers keep the nodes of the wanted elements (only the unwanted
+    /// ones are unlinked), contiguous ones compact the wanted elements in their buffer.
+    template <class SourceContainer, class Element,
+              std::enable_if_t<!std::is_lvalue_reference<SourceContainer>::value && !std::is_const<SourceContainer>::value, int> = 0>
+    SourceContainer removeElement(SourceContainer&& source, const Element& elementToRemove)
+    {
+        removeElementInPlace(source, elementToRemove);
+        return std::move(source);
+    }
+
+    /// Split the \p source container into elements not present in \p elementsToRemove and the ones present there, in one traversal.
+    /// \tparam SourceContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
+    /// \param source Source container to partition. It won't be changed in any way.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \return Pair of new \p SourceContainer objects: the first one is equal to removeElements(source, elementsToRemove),
+    /// the second one holds the removed elements, in the order of the \p source.
+    /// \remark Membership in the blacklist is tested once per element, the same way as in removeElements. The first container
+    /// reserves and releases its capacity the same way, too.
+    template <class SourceContainer, class BlacklistContainer>
+    std::pair<SourceContainer, SourceContainer> partitionElements(const SourceContainer& source, const BlacklistContainer& elementsToRemove)
+    {
+        std::pair<SourceContainer, SourceContainer> partitions;
+        detail::reserveElements(partitions.first, source.size());
+        auto wanted = std::back_inserter(partitions.first);
+        auto unwanted = std::back_inserter(partitions.second);
+        detail::visitMembership(source, elementsToRemove, [&wanted, &unwanted](const auto &currentElement, bool blacklisted)
+        {
+            if (blacklisted)
+            {
+                *unwanted++ = currentElement;
+            }
+            else
+            {
+                *wanted++ = currentElement;
+            }
+        });
+        detail::releaseExcessCapacity(partitions.first);
+        return partitions;
+    }
+
+    /// Reorder in-place the \p source container, so elements not present in \p elementsToRemove precede the ones present there.
+    /// \tparam SourceContainer Some container type, should provide begin(), end() with bidirectional iterators.
+    /// \tparam BlacklistContainer Some container type, should provide cbegin(), cend().
+    /// \param source Source container to partition. It will be reordered, but no element is removed.
+    /// \param elementsToRemove Blacklist in a form of a \p BlacklistContainer, storing all elements which should be removed.
+    /// \param order Whether the relative order of elements within both groups has to be preserved.
+    /// \return Iterator to the first blacklisted element (the split point); source.erase(split, source.end()) completes the removal.
+    /// \remark Membership in the blacklist is tested once per element, the same way as in removeElementsInPlace.
+    template <class SourceContainer, class BlacklistContainer>
+    typename SourceContainer::iterator partitionElementsInPlace(SourceContainer& source, const BlacklistContainer& elementsToRemove,
+                                                                partition_order_t order = partition_order_t::stable)
+    {
+        const auto partition = [&source, order](const auto &isWanted)
+        {
+            if (order == partition_order_t::stable)
+            {
+                return std::stable_partition(source.begin(), source.end(), isWanted);
+            }
+            return std::partition(source.begin(), source.end(), isWanted);
+        };
+
+        if constexpr (detail::is_indexable_lookup_v<SourceContainer, BlacklistContainer>)
+        {
+            if (static_cast<const void *>(&source) == static_cast<const void *>(&elementsToRemove))
+            {
+                // every element is blacklisted; the index can't refer to the elements being moved around:
+                return source.begin();
+            }
+
+            const MembershipIndex<BlacklistContainer> index{elementsToRemove, detail::elementsCount(source)};
+            return partition([&index](const auto &currentElement)
+            {
+                return !index.contains(currentElement);
+            });
+        }
+        else
+        {
+            return partition([&elementsToRemove](const auto &currentElement)
+            {
+                return std::find(elementsToRemove.cbegin(), elementsToRemove.cend(), currentElement) == elementsToRemove.cend();
+            });
+        }
     }
 }
\ No newline at end of file
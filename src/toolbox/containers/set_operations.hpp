@@ -0,0 +1,166 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./membership.hpp"
+#include "./remove.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace toolbox::container
+{
+    /// Write elements of \p first container which are present in \p second container to the \p output.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend().
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \tparam OutputIterator Output iterator accepting elements of \p FirstContainer.
+    /// \param first Container which elements are written, in its order (duplicates included).
+    /// \param second Container which elements are searched for.
+    /// \param output Destination of the intersection.
+    /// \return Output iterator past the last written element.
+    /// \remark The \p second container is indexed by MembershipIndex (bitmap for dense integers, hash set, or sorted array
+    /// with binary search), depending on sizes and element type - the same way as in removeElements.
+    template <class FirstContainer, class SecondContainer, class OutputIterator>
+    OutputIterator setIntersection(const FirstContainer& first, const SecondContainer& second, OutputIterator output)
+    {
+        detail::visitMembership(first, second, [&output](const auto &element, bool inSecond)
+        {
+            if (inSecond)
+            {
+                *output++ = element;
+            }
+        });
+        return output;
+    }
+
+    /// Write elements of \p first container which are not present in \p second container to the \p output.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend().
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \tparam OutputIterator Output iterator accepting elements of \p FirstContainer.
+    /// \param first Container which elements are written, in its order (duplicates included).
+    /// \param second Container which elements are excluded.
+    /// \param output Destination of the difference.
+    /// \return Output iterator past the last written element.
+    /// \remark Writes the same elements as removeElements(first, second) returns.
+    template <class FirstContainer, class SecondContainer, class OutputIterator>
+    OutputIterator setDifference(const FirstContainer& first, const SecondContainer& second, OutputIterator output)
+    {
+        detail::visitMembership(first, second, [&output](const auto &element, bool inSecond)
+        {
+            if (!inSecond)
+            {
+                *output++ = element;
+            }
+        });
+        return output;
+    }
+
+    /// Write all elements of \p first container followed by elements of \p second container not present in the \p first one.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend().
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \tparam OutputIterator Output iterator accepting elements of both containers.
+    /// \param first Container which elements are written first, in its order (duplicates included).
+    /// \param second Container which elements missing in the \p first one are written next, in its order.
+    /// \param output Destination of the union.
+    /// \return Output iterator past the last written element.
+    template <class FirstContainer, class SecondContainer, class OutputIterator>
+    OutputIterator setUnion(const FirstContainer& first, const SecondContainer& second, OutputIterator output)
+    {
+        output = std::copy(first.cbegin(), first.cend(), output);
+        return setDifference(second, first, output);
+    }
+
+    /// Write elements of \p first container not present in \p second container, followed by elements of the \p second container
+    /// not present in the \p first one.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend().
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \tparam OutputIterator Output iterator accepting elements of both containers.
+    /// \param first Container which unique elements are written first, in its order.
+    /// \param second Container which unique elements are written next, in its order.
+    /// \param output Destination of the symmetric difference.
+    /// \return Output iterator past the last written element.
+    template <class FirstContainer, class SecondContainer, class OutputIterator>
+    OutputIterator setSymmetricDifference(const FirstContainer& first, const SecondContainer& second, OutputIterator output)
+    {
+        output = setDifference(first, second, output);
+        return setDifference(second, first, output);
+    }
+
+    /// Return elements of \p first container which are present in \p second container.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \param first Container which elements are kept, in its order (duplicates included).
+    /// \param second Container which elements are searched for.
+    /// \return New \p FirstContainer object with the intersection.
+    template <class FirstContainer, class SecondContainer>
+    FirstContainer setIntersection(const FirstContainer& first, const SecondContainer& second)
+    {
+        FirstContainer result;
+        setIntersection(first, second, std::back_inserter(result));
+        return result;
+    }
+
+    /// Return elements of \p first container which are not present in \p second container.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \param first Container which elements are kept, in its order (duplicates included).
+    /// \param second Container which elements are excluded.
+    /// \return New \p FirstContainer object with the difference, equal to removeElements(first, second).
+    template <class FirstContainer, class SecondContainer>
+    FirstContainer setDifference(const FirstContainer& first, const SecondContainer& second)
+    {
+        return removeElements(first, second);
+    }
+
+    /// Return all elements of \p first container followed by elements of \p second container not present in the \p first one.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \param first Container which elements are written first, in its order (duplicates included).
+    /// \param second Container which elements missing in the \p first one are written next, in its order.
+    /// \return New \p FirstContainer object with the union.
+    template <class FirstContainer, class SecondContainer>
+    FirstContainer setUnion(const FirstContainer& first, const SecondContainer& second)
+    {
+        FirstContainer result;
+        detail::reserveElements(result, first.size() + second.size());
+        setUnion(first, second, std::back_inserter(result));
+        return result;
+    }
+
+    /// Return elements of \p first container not present in \p second container, followed by elements of the \p second container
+    /// not present in the \p first one.
+    /// \tparam FirstContainer Some container type, should provide cbegin(), cend(), compatibility with std::back_inserter.
+    /// \tparam SecondContainer Some container type, should provide cbegin(), cend().
+    /// \param first Container which unique elements are written first, in its order.
+    /// \param second Container which unique elements are written next, in its order.
+    /// \return New \p FirstContainer object with the symmetric difference.
+    template <class FirstContainer, class SecondContainer>
+    FirstContainer setSymmetricDifference(const FirstContainer& first, const SecondContainer& second)
+    {
+        FirstContainer result;
+        setSymmetricDifference(first, second, std::back_inserter(result));
+        return result;
+    }
+}
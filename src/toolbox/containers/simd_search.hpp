@@ -0,0 +1,374 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./sorted.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace toolbox::container
+{
+    namespace detail
+    {
+        /// Check whether \p T is handled by the SIMD kernels: float, double or integer of 1, 2, 4 or 8 bytes. Other arithmetic
+        /// types (long double, __int128) don't fit the lanes and are searched with std::find.
+        template <class T>
+        inline constexpr bool is_simd_lane_type_v = std::is_same<T, float>::value || std::is_same<T, double>::value ||
+                                                    (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                                     (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
+
+        /// Check whether \p ElementType can be searched for in contiguous \p SourceContainer with SIMD comparisons,
+        /// giving the same results as operator== used by std::find.
+        /// \remark Mixed types are allowed only for integers, where converting the searched value to the element type
+        /// doesn't change the outcome (see findEqual).
+        template <class SourceContainer, class ElementType>
+        inline constexpr bool is_simd_searchable_v = []
+        {
+            using source_t = std::remove_cv_t<typename SourceContainer::value_type>;
+            using element_t = std::remove_cv_t<std::remove_reference_t<ElementType>>;
+            if constexpr (!has_data<SourceContainer>::value || !is_simd_lane_type_v<source_t> || !is_simd_lane_type_v<element_t>)
+            {
+                return false;
+            }
+            else
+            {
+                return std::is_same<source_t, element_t>::value || (std::is_integral<source_t>::value && std::is_integral<element_t>::value);
+            }
+        }();
+
+        /// Return index of the first element of \p data equal to \p value, or \p count if there is none.
+        template <class T>
+        size_t findEqualScalar(const T *data, size_t count, T value) noexcept
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Check whether the CPU provides AVX2 instructions.
+        inline bool hasAvx2() noexcept
+        {
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return supported;
+        }
+
+        /// Index of the first lane set in the byte mask of compared vectors.
+        template <class T>
+        size_t firstLane(unsigned mask) noexcept
+        {
+            return static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T);
+        }
+
+        template <class T>
+        inline __m128i broadcast128(T value) noexcept
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                return _mm_castps_si128(_mm_set1_ps(value));
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                return _mm_castpd_si128(_mm_set1_pd(value));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                return _mm_set1_epi8(static_cast<char>(value));
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return _mm_set1_epi16(static_cast<short>(value));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return _mm_set1_epi32(static_cast<int>(value));
+            }
+            else
+            {
+                return _mm_set1_epi64x(static_cast<long long>(value));
+            }
+        }
+
+        /// Compare lanes of \p T elements for equality; equal lanes are set to all ones.
+        template <class T>
+        inline __m128i equalLanes128(__m128i first, __m128i second) noexcept
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(first), _mm_castsi128_ps(second)));
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(first), _mm_castsi128_pd(second)));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                return _mm_cmpeq_epi8(first, second);
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return _mm_cmpeq_epi16(first, second);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return _mm_cmpeq_epi32(first, second);
+            }
+            else
+            {
+                // SSE2 has no 64-bit comparison: both 32-bit halves have to be equal
+                const __m128i equalHalves = _mm_cmpeq_epi32(first, second);
+                return _mm_and_si128(equalHalves, _mm_shuffle_epi32(equalHalves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+
+        /// SSE2 (x86-64 baseline) version of findEqualScalar, comparing 4 vectors per iteration.
+        template <class T>
+        size_t findEqualSse2(const T *data, size_t count, T value) noexcept
+        {
+            constexpr size_t lanes = sizeof(__m128i) / sizeof(T);
+            const __m128i needle = broadcast128(value);
+            const auto load = [data](size_t index)
+            {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+            };
+
+            size_t i{0};
+            for (; i + 4 * lanes <= count; i += 4 * lanes)
+            {
+                const __m128i equal0 = equalLanes128<T>(load(i), needle);
+                const __m128i equal1 = equalLanes128<T>(load(i + lanes), needle);
+                const __m128i equal2 = equalLanes128<T>(load(i + 2 * lanes), needle);
+                const __m128i equal3 = equalLanes128<T>(load(i + 3 * lanes), needle);
+                const __m128i any = _mm_or_si128(_mm_or_si128(equal0, equal1), _mm_or_si128(equal2, equal3));
+                if (_mm_movemask_epi8(any) != 0)
+                {
+                    const __m128i equal[] = {equal0, equal1, equal2, equal3};
+                    for (size_t block = 0;; ++block)
+                    {
+                        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(equal[block]));
+                        if (mask != 0)
+                        {
+                            return i + block * lanes + firstLane<T>(mask);
+                        }
+                    }
+                }
+            }
+            for (; i + lanes <= count; i += lanes)
+            {
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8(equalLanes128<T>(load(i), needle)));
+                if (mask != 0)
+                {
+                    return i + firstLane<T>(mask);
+                }
+            }
+            return i + findEqualScalar(data + i, count - i, value);
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        inline __m256i broadcast256(T value) noexcept
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                return _mm256_castps_si256(_mm256_set1_ps(value));
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                return _mm256_castpd_si256(_mm256_set1_pd(value));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return _mm256_set1_epi16(static_cast<short>(value));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return _mm256_set1_epi32(static_cast<int>(value));
+            }
+            else
+            {
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+            }
+        }
+
+        /// Compare lanes of \p T elements for equality; equal lanes are set to all ones.
+        template <class T>
+        __attribute__((target("avx2")))
+        inline __m256i equalLanes256(__m256i first, __m256i second) noexcept
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(first), _mm256_castsi256_ps(second), _CMP_EQ_OQ));
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(first), _mm256_castsi256_pd(second), _CMP_EQ_OQ));
+            }
+            else if constexpr (sizeof(T) == 1)
+            {
+                return _mm256_cmpeq_epi8(first, second);
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                return _mm256_cmpeq_epi16(first, second);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return _mm256_cmpeq_epi32(first, second);
+            }
+            else
+            {
+                return _mm256_cmpeq_epi64(first, second);
+            }
+        }
+
+        template <class T>
+        __attribute__((target("avx2")))
+        inline __m256i loadLanes256(const T *data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        }
+
+        /// AVX2 version of findEqualScalar, comparing 4 vectors (32 - 128 elements) per iteration.
+        template <class T>
+        __attribute__((target("avx2")))
+        size_t findEqualAvx2(const T *data, size_t count, T value) noexcept
+        {
+            constexpr size_t lanes = sizeof(__m256i) / sizeof(T);
+            const __m256i needle = broadcast256(value);
+
+            size_t i{0};
+            for (; i + 4 * lanes <= count; i += 4 * lanes)
+            {
+                const __m256i equal0 = equalLanes256<T>(loadLanes256(data + i), needle);
+                const __m256i equal1 = equalLanes256<T>(loadLanes256(data + i + lanes), needle);
+                const __m256i equal2 = equalLanes256<T>(loadLanes256(data + i + 2 * lanes), needle);
+                const __m256i equal3 = equalLanes256<T>(loadLanes256(data + i + 3 * lanes), needle);
+                const __m256i any = _mm256_or_si256(_mm256_or_si256(equal0, equal1), _mm256_or_si256(equal2, equal3));
+                if (!_mm256_testz_si256(any, any))
+                {
+                    const __m256i equal[] = {equal0, equal1, equal2, equal3};
+                    for (size_t block = 0;; ++block)
+                    {
+                        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(equal[block]));
+                        if (mask != 0)
+                        {
+                            return i + block * lanes + firstLane<T>(mask);
+                        }
+                    }
+                }
+            }
+            for (; i + lanes <= count; i += lanes)
+            {
+                const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(equalLanes256<T>(loadLanes256(data + i), needle)));
+                if (mask != 0)
+                {
+                    return i + firstLane<T>(mask);
+                }
+            }
+            return i + findEqualScalar(data + i, count - i, value);
+        }
+#endif
+
+        /// Return index of the first element of \p data equal to \p value, or \p count if there is none.
+        /// \remark Uses AVX2 when the CPU supports it (detected at runtime), SSE2 otherwise on x86-64; scalar loop elsewhere.
+        template <class T>
+        size_t findEqual(const T *data, size_t count, T value) noexcept
+        {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (hasAvx2())
+            {
+                return findEqualAvx2(data, count, value);
+            }
+            return findEqualSse2(data, count, value);
+#else
+            return findEqualScalar(data, count, value);
+#endif
+        }
+
+        /// Convert \p value to \p T, without a cast when it's already of that type.
+        template <class T, class V>
+        constexpr T convertTo(V value) noexcept
+        {
+            if constexpr (std::is_same<T, V>::value)
+            {
+                return value;
+            }
+            else
+            {
+                return static_cast<T>(value);
+            }
+        }
+
+        /// Convert searched \p element to the type \p T of the searched elements.
+        /// \return False if no element of type \p T can be equal (operator==) to the \p element.
+        template <class T, class ElementType>
+        bool convertSearchedValue(const ElementType &element, T &converted) noexcept
+        {
+            using element_t = std::remove_cv_t<ElementType>;
+
+            converted = convertTo<T>(element);
+            if constexpr (!std::is_same<T, element_t>::value)
+            {
+                // operator== compares integers converted to their common type, where the conversion of T is injective;
+                // so if converting the searched value changes it there, no element can be equal to it:
+                using common_t = std::common_type_t<T, element_t>;
+                return convertTo<common_t>(converted) == convertTo<common_t>(element);
+            }
+            return true;
+        }
+
+        /// Find \p element in contiguous \p source with findEqual; see is_simd_searchable_v.
+        /// \return Index of the first equal element, or size of the \p source if there is none.
+        template <class SourceContainer, class ElementType>
+        size_t findEqualElement(const SourceContainer &source, const ElementType &element) noexcept
+        {
+            std::remove_cv_t<typename SourceContainer::value_type> searched{};
+            if (!convertSearchedValue(element, searched))
+            {
+                return source.size();
+            }
+            return findEqual(source.data(), source.size(), searched);
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace toolbox::container
+{
+    /// Tag selecting overloads which assume that the given containers are sorted in ascending order (by operator<).
+    /// \example containsAny(sorted_range, sortedIds, otherSortedIds)
+    struct sorted_range_t
+    {
+        explicit sorted_range_t() = default;
+    };
+
+    /// Tag selecting overloads which assume that the given containers are sorted in ascending order (by operator<).
+    inline constexpr sorted_range_t sorted_range{};
+
+    namespace detail
+    {
+        /// When one input is this many times longer than the other one, it's galloped through instead of merged.
+        inline constexpr size_t gallopingSizeRatio = 16;
+
+        template <class Iterator>
+        inline constexpr bool is_random_access_v = std::is_base_of<std::random_access_iterator_tag,
+                                                                   typename std::iterator_traits<Iterator>::iterator_category>::value;
+
+        template <class Container, class = void>
+        struct has_data : std::false_type
+        {
+        };
+
+        template <class Container>
+        struct has_data<Container, std::void_t<decltype(std::declval<const Container &>().data())>>
+                : std::is_pointer<decltype(std::declval<const Container &>().data())>
+        {
+        };
+
+        /// Check whether both containers store 32-bit integers contiguously, so they can be intersected with SIMD.
+        template <class FirstContainer, class SecondContainer>
+        inline constexpr bool is_simd_intersectable_v =
+                has_data<FirstContainer>::value && has_data<SecondContainer>::value &&
+                std::is_same<std::remove_cv_t<typename FirstContainer::value_type>, std::remove_cv_t<typename SecondContainer::value_type>>::value &&
+                (std::is_same<std::remove_cv_t<typename FirstContainer::value_type>, uint32_t>::value ||
+                 std::is_same<std::remove_cv_t<typename FirstContainer::value_type>, int32_t>::value);
+
+        /// Find the first element of sorted [\p first, \p last) which is not less than \p value, with exponential search
+        /// starting from \p first, so it costs O(log d) for the element d positions further.
+        template <class Iterator, class T>
+        Iterator gallopingLowerBound(Iterator first, Iterator last, const T &value)
+        {
+            typename std::iterator_traits<Iterator>::difference_type step{1};
+            while (last - first > step && *(first + step) < value)
+            {
+                first += step;
+                step *= 2;
+            }
+            return std::lower_bound(first, last - first > step ? first + step + 1 : last, value);
+        }
+
+        /// Advance \p current to the first element not less than \p value, by galloping or one by one.
+        template <class Iterator, class T>
+        Iterator advanceLowerBound(Iterator current, Iterator last, const T &value, bool galloping)
+        {
+            if constexpr (is_random_access_v<Iterator>)
+            {
+                if (galloping)
+                {
+                    return gallopingLowerBound(current, last, value);
+                }
+            }
+            while (current != last && *current < value)
+            {
+                ++current;
+            }
+            return current;
+        }
+
+        /// Check whether the sorted \p larger range should be galloped through while walking the sorted \p smaller one.
+        template <class SmallerContainer, class LargerContainer>
+        bool shouldGallop(const SmallerContainer &smaller, const LargerContainer &larger)
+        {
+            if constexpr (is_random_access_v<typename LargerContainer::const_iterator>)
+            {
+                const auto smallerCount = static_cast<size_t>(std::distance(smaller.cbegin(), smaller.cend()));
+                return static_cast<size_t>(larger.cend() - larger.cbegin()) / gallopingSizeRatio > smallerCount;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        /// Test whether the sorted ranges have a common element; walks the \p second range with advanceLowerBound.
+        template <class FirstIterator, class SecondIterator>
+        bool sortedIntersect(FirstIterator first, FirstIterator firstEnd, SecondIterator second, SecondIterator secondEnd,
+                             bool gallopingSecond)
+        {
+            for (; first != firstEnd; ++first)
+            {
+                second = advanceLowerBound(second, secondEnd, *first, gallopingSecond);
+                if (second == secondEnd)
+                {
+                    return false;
+                }
+                if (!(*first < *second))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+#if defined(__SSE2__)
+        /// Test whether the sorted arrays of 32-bit integers have a common element, comparing blocks of 4x4 elements at once.
+        template <class T>
+        bool sortedIntersectSimd(const T *first, size_t firstCount, const T *second, size_t secondCount)
+        {
+            static_assert(sizeof(T) == 4, "'T' should be 32-bit integer type.");
+
+            size_t i{0};
+            size_t j{0};
+            while (i + 4 <= firstCount && j + 4 <= secondCount)
+            {
+                const __m128i firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+                const __m128i secondBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(second + j));
+
+                // compare every pair of the elements of both blocks, rotating the second one:
+                __m128i equal = _mm_cmpeq_epi32(firstBlock, secondBlock);
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(firstBlock, _mm_shuffle_epi32(secondBlock, _MM_SHUFFLE(0, 3, 2, 1))));
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(firstBlock, _mm_shuffle_epi32(secondBlock, _MM_SHUFFLE(1, 0, 3, 2))));
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(firstBlock, _mm_shuffle_epi32(secondBlock, _MM_SHUFFLE(2, 1, 0, 3))));
+                if (_mm_movemask_epi8(equal) != 0)
+                {
+                    return true;
+                }
+
+                // the block with smaller last element can't intersect anything further:
+                const T firstLast = first[i + 3];
+                const T secondLast = second[j + 3];
+                i += firstLast <= secondLast ? 4 : 0;
+                j += secondLast <= firstLast ? 4 : 0;
+            }
+            return sortedIntersect(first + i, first + firstCount, second + j, second + secondCount, false);
+        }
+#endif
+    }
+}
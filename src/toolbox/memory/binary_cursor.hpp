@@ -0,0 +1,235 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./endianness.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace toolbox::memory
+{
+    /// Cursor reading binary values from a buffer, without copying the buffer.
+    /// \remark Every read is bounds checked and throws std::out_of_range on overrun. When the size of a batch of reads
+    /// is known up front, call require() once and use the unchecked variants inside the batch.
+    class BinaryReader
+    {
+    public:
+        /// Create reader over the buffer. The buffer has to outlive the reader.
+        /// \param data Buffer to be read.
+        /// \param size Size of the buffer in bytes.
+        BinaryReader(const uint8_t *data, size_t size) noexcept
+                : data_{data}, size_{size}
+        {
+        }
+
+        /// Check whether at least \p bytesCount bytes are left to read.
+        /// \throws If there are less than \p bytesCount bytes left, \p std::out_of_range exception is thrown.
+        void require(size_t bytesCount) const
+        {
+            if (bytesCount > remaining())
+            {
+                throwOverrun(bytesCount);
+            }
+        }
+
+        /// Read a value stored in the given byte order and advance the cursor.
+        /// \tparam T Integral or IEEE floating point type.
+        /// \tparam order Byte order of the stored value.
+        /// \return Value in the CPU byte order.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        template <typename T, endianness_t order = endianness_t::big>
+        T read()
+        {
+            require(sizeof(T));
+            return readUnchecked<T, order>();
+        }
+
+        /// Read a value stored in the given byte order and advance the cursor, without bounds checking.
+        /// \remark Enough bytes have to be guaranteed with a preceding require() call.
+        /// \tparam T Integral or IEEE floating point type.
+        /// \tparam order Byte order of the stored value.
+        /// \return Value in the CPU byte order.
+        template <typename T, endianness_t order = endianness_t::big>
+        T readUnchecked() noexcept
+        {
+            static_assert(std::is_arithmetic<T>::value, "'T' should be fundamental arithmetic type.");
+            T value{};
+            std::memcpy(&value, data_ + position_, sizeof(T));
+            position_ += sizeof(T);
+            return toEndianness<order>(value);
+        }
+
+        /// Read \p length bytes as a string view into the buffer (no copy) and advance the cursor.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        std::string_view readStringView(size_t length)
+        {
+            require(length);
+            const std::string_view view{reinterpret_cast<const char *>(data_ + position_), length};
+            position_ += length;
+            return view;
+        }
+
+        /// Return pointer to the next \p length bytes of the buffer (no copy) and advance the cursor.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        const uint8_t *readBytes(size_t length)
+        {
+            require(length);
+            const uint8_t *bytes = data_ + position_;
+            position_ += length;
+            return bytes;
+        }
+
+        /// Advance the cursor by \p length bytes.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        void skip(size_t length)
+        {
+            require(length);
+            position_ += length;
+        }
+
+        /// Return current position of the cursor, counted in bytes from the beginning of the buffer.
+        size_t position() const noexcept
+        {
+            return position_;
+        }
+
+        /// Return number of bytes left to read.
+        size_t remaining() const noexcept
+        {
+            return size_ - position_;
+        }
+
+    private:
+        // cold, never inlined and [[noreturn]], so the optimizer treats the failed check as a dead end:
+        [[noreturn, gnu::cold, gnu::noinline]] void throwOverrun(size_t bytesCount) const
+        {
+            throw std::out_of_range{"Reading " + std::to_string(bytesCount) + " bytes at position " + std::to_string(position_) +
+                                    " exceeds buffer of size " + std::to_string(size_) + "."};
+        }
+
+        const uint8_t *data_;
+        size_t size_;
+        size_t position_{0};
+    };
+
+    /// Cursor writing binary values to a buffer.
+    /// \remark Every write is bounds checked and throws std::out_of_range on overrun. When the size of a batch of writes
+    /// is known up front, call require() once and use the unchecked variants inside the batch.
+    class BinaryWriter
+    {
+    public:
+        /// Create writer over the buffer. The buffer has to outlive the writer.
+        /// \param data Buffer to be written.
+        /// \param size Size of the buffer in bytes.
+        BinaryWriter(uint8_t *data, size_t size) noexcept
+                : data_{data}, size_{size}
+        {
+        }
+
+        /// Check whether at least \p bytesCount bytes are left to write.
+        /// \throws If there are less than \p bytesCount bytes left, \p std::out_of_range exception is thrown.
+        void require(size_t bytesCount) const
+        {
+            if (bytesCount > remaining())
+            {
+                throwOverrun(bytesCount);
+            }
+        }
+
+        /// Write a value in the given byte order and advance the cursor.
+        /// \tparam T Integral or IEEE floating point type.
+        /// \tparam order Byte order of the written value.
+        /// \param value Value in the CPU byte order.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        template <typename T, endianness_t order = endianness_t::big>
+        void write(T value)
+        {
+            require(sizeof(T));
+            writeUnchecked<T, order>(value);
+        }
+
+        /// Write a value in the given byte order and advance the cursor, without bounds checking.
+        /// \remark Enough bytes have to be guaranteed with a preceding require() call.
+        /// \tparam T Integral or IEEE floating point type.
+        /// \tparam order Byte order of the written value.
+        /// \param value Value in the CPU byte order.
+        template <typename T, endianness_t order = endianness_t::big>
+        void writeUnchecked(T value) noexcept
+        {
+            static_assert(std::is_arithmetic<T>::value, "'T' should be fundamental arithmetic type.");
+            value = toEndianness<order>(value);
+            std::memcpy(data_ + position_, &value, sizeof(T));
+            position_ += sizeof(T);
+        }
+
+        /// Write raw bytes and advance the cursor.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        void writeBytes(const uint8_t *bytes, size_t length)
+        {
+            require(length);
+            if (length > 0)
+            {
+                std::memcpy(data_ + position_, bytes, length);
+            }
+            position_ += length;
+        }
+
+        /// Write characters of the \p text (without null terminator) and advance the cursor.
+        /// \throws If there is not enough bytes left, \p std::out_of_range exception is thrown.
+        void writeString(std::string_view text)
+        {
+            writeBytes(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+        }
+
+        /// Return current position of the cursor, which is also number of bytes written so far.
+        size_t position() const noexcept
+        {
+            return position_;
+        }
+
+        /// Return number of bytes left to write.
+        size_t remaining() const noexcept
+        {
+            return size_ - position_;
+        }
+
+    private:
+        // cold, never inlined and [[noreturn]], so the optimizer treats the failed check as a dead end:
+        [[noreturn, gnu::cold, gnu::noinline]] void throwOverrun(size_t bytesCount) const
+        {
+            throw std::out_of_range{"Writing " + std::to_string(bytesCount) + " bytes at position " + std::to_string(position_) +
+                                    " exceeds buffer of size " + std::to_string(size_) + "."};
+        }
+
+        uint8_t *data_;
+        size_t size_;
+        size_t position_{0};
+    };
+}
@@ -0,0 +1,313 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./endianness.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace toolbox::memory
+{
+    /// Order of bits within the stream.
+    enum class bit_order_t
+    {
+        msb_first, ///< the first bit is the most significant bit of the first byte; values are written starting from their most significant bit
+        lsb_first  ///< the first bit is the least significant bit of the first byte; values are written starting from their least significant bit
+    };
+
+    namespace detail
+    {
+        /// Mask of the lowest \p bitsCount bits.
+        constexpr uint64_t lowBitsMask(size_t bitsCount) noexcept
+        {
+            return bitsCount >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << bitsCount) - 1;
+        }
+    }
+
+    /// Writer of values of any bit width (up to 64) to a caller buffer.
+    /// \remark Bits are gathered in a 64-bit accumulator holding less than a byte between writes. Every write stores the whole
+    /// accumulator word unconditionally and advances by the completed bytes, so there is no data dependent branch nor
+    /// per-byte loop; bytes past the written bits (within the buffer) may be overwritten with zeros meanwhile.
+    /// \remark Each write is a dependency chain of about 3 cycles, so mixed widths of 1 - 16 bits are written at about 1 GB/s
+    /// on a 3 GHz core (see the benchmarks); the target isn't reached on slower clocks - at 1.4 GHz it's about 0.5 GB/s.
+    /// \tparam bitOrder Order of bits within the stream.
+    template <bit_order_t bitOrder = bit_order_t::msb_first>
+    class BitWriter
+    {
+    public:
+        /// Create writer over the buffer. The buffer has to outlive the writer.
+        /// \param data Buffer to be written.
+        /// \param size Size of the buffer in bytes.
+        BitWriter(uint8_t *data, size_t size) noexcept
+                : data_{data}, size_{size}
+        {
+        }
+
+        /// Write the lowest \p bitsCount bits of the \p value.
+        /// \param value Value to be written; bits above \p bitsCount are ignored.
+        /// \param bitsCount Number of bits to be written, 0 - 64.
+        /// \throws If the buffer is too small for the written bits, \p std::out_of_range exception is thrown.
+        void write(uint64_t value, size_t bitsCount)
+        {
+            // a single word store covers up to 57 bits at any bit offset:
+            if (bitsCount > 56)
+            {
+                if constexpr (bitOrder == bit_order_t::msb_first)
+                {
+                    write(value >> 32u, bitsCount - 32);
+                    write(value & 0xFFFFFFFFu, 32);
+                }
+                else
+                {
+                    write(value & 0xFFFFFFFFu, 32);
+                    write(value >> 32u, bitsCount - 32);
+                }
+                return;
+            }
+            if (bitsCount == 0)
+            {
+                return;
+            }
+
+            // members are read before the store, which may alias them (uint8_t), so they can stay in registers:
+            const size_t position = position_;
+            const size_t totalBits = bits_ + bitsCount;
+            const uint64_t accumulator = accumulator_ | shiftIntoAccumulator(value & ((uint64_t{1} << bitsCount) - 1), bitsCount);
+            const size_t completedBytes = totalBits / 8;
+            const uint64_t word = bitOrder == bit_order_t::msb_first ? toBigEndian(accumulator) : toLittleEndian(accumulator);
+            if (size_ - position >= sizeof(word))
+            {
+                std::memcpy(data_ + position, &word, sizeof(word));
+            }
+            else
+            {
+                storeTail(word, completedBytes);
+            }
+
+            position_ = position + completedBytes;
+            bits_ = totalBits % 8;
+            if constexpr (bitOrder == bit_order_t::msb_first)
+            {
+                accumulator_ = accumulator << (8 * completedBytes);
+            }
+            else
+            {
+                accumulator_ = accumulator >> (8 * completedBytes);
+            }
+        }
+
+        /// Write bits left in the accumulator, padding the last byte with zero bits. The writer shouldn't be used afterwards.
+        /// \return Number of bytes written to the buffer.
+        /// \throws If the buffer is too small for the written bits, \p std::out_of_range exception is thrown.
+        size_t finish()
+        {
+            const size_t bytesCount = (bits_ + 7) / 8;
+            if (bytesCount > size_ - position_)
+            {
+                throwOverrun(bytesCount, position_, size_);
+            }
+
+            for (size_t i = 0; i < bytesCount; ++i)
+            {
+                const size_t shift = bitOrder == bit_order_t::msb_first ? 56 - 8 * i : 8 * i;
+                data_[position_ + i] = static_cast<uint8_t>(accumulator_ >> shift);
+            }
+
+            position_ += bytesCount;
+            accumulator_ = 0;
+            bits_ = 0;
+            return position_;
+        }
+
+        /// Return number of bits written so far.
+        size_t bitsWritten() const noexcept
+        {
+            return position_ * 8 + bits_;
+        }
+
+    private:
+        /// Place non-zero number of bits of \p value right after the bits already held in the accumulator.
+        /// \remark MSB first accumulator is filled from its most significant bit, LSB first one from the least significant bit.
+        uint64_t shiftIntoAccumulator(uint64_t value, size_t bitsCount) const noexcept
+        {
+            if constexpr (bitOrder == bit_order_t::msb_first)
+            {
+                return (value << (64 - bitsCount)) >> bits_;
+            }
+            else
+            {
+                return value << bits_;
+            }
+        }
+
+        /// Store the \p completedBytes bytes of the \p word near the end of the buffer, where the whole word doesn't fit.
+        void storeTail(uint64_t word, size_t completedBytes)
+        {
+            if (completedBytes > size_ - position_)
+            {
+                throwOverrun(completedBytes, position_, size_);
+            }
+            std::memcpy(data_ + position_, &word, completedBytes);
+        }
+
+        // cold, never inlined and [[noreturn]], so the exception message building stays out of write(); static, so the address
+        // of the writer doesn't escape and its members can stay in registers:
+        [[noreturn, gnu::cold, gnu::noinline]] static void throwOverrun(size_t bytesCount, size_t position, size_t size)
+        {
+            throw std::out_of_range{"Writing " + std::to_string(bytesCount) + " bytes at position " + std::to_string(position) +
+                                    " exceeds buffer of size " + std::to_string(size) + "."};
+        }
+
+        uint8_t *data_;
+        size_t size_;
+        size_t position_{0};
+        uint64_t accumulator_{0};
+        size_t bits_{0};
+    };
+
+    /// Reader of values of any bit width (up to 64) from a buffer written by BitWriter.
+    /// \tparam bitOrder Order of bits within the stream.
+    template <bit_order_t bitOrder = bit_order_t::msb_first>
+    class BitReader
+    {
+    public:
+        /// Create reader over the buffer. The buffer has to outlive the reader.
+        /// \param data Buffer to be read.
+        /// \param size Size of the buffer in bytes.
+        BitReader(const uint8_t *data, size_t size) noexcept
+                : data_{data}, size_{size}
+        {
+        }
+
+        /// Read \p bitsCount bits as an unsigned value.
+        /// \param bitsCount Number of bits to be read, 0 - 64.
+        /// \return Read value.
+        /// \throws If there is less than \p bitsCount bits left, \p std::out_of_range exception is thrown.
+        uint64_t read(size_t bitsCount)
+        {
+            if (bitsCount > remainingBits())
+            {
+                throwOverrun(bitsCount, position_, size_);
+            }
+
+            // single word load covers up to 57 bits at any bit offset:
+            if (bitsCount > 56)
+            {
+                if constexpr (bitOrder == bit_order_t::msb_first)
+                {
+                    const uint64_t high = readBits(bitsCount - 32);
+                    return (high << 32u) | readBits(32);
+                }
+                else
+                {
+                    const uint64_t low = readBits(32);
+                    return low | (readBits(bitsCount - 32) << 32u);
+                }
+            }
+            return readBits(bitsCount);
+        }
+
+        /// Return number of bits read so far.
+        size_t bitsRead() const noexcept
+        {
+            return position_;
+        }
+
+        /// Return number of bits left to read.
+        size_t remainingBits() const noexcept
+        {
+            return size_ * 8 - position_;
+        }
+
+    private:
+        // cold, never inlined and [[noreturn]], so the exception message building stays out of read(); static, so the address
+        // of the reader doesn't escape and its members can stay in registers:
+        [[noreturn, gnu::cold, gnu::noinline]] static void throwOverrun(size_t bitsCount, size_t position, size_t size)
+        {
+            throw std::out_of_range{"Reading " + std::to_string(bitsCount) + " bits at position " + std::to_string(position) +
+                                    " exceeds buffer of " + std::to_string(size * 8) + " bits."};
+        }
+
+        uint64_t readBits(size_t bitsCount) noexcept
+        {
+            if (bitsCount == 0)
+            {
+                return 0;
+            }
+
+            const size_t byte = position_ / 8;
+            const size_t shift = position_ % 8;
+            position_ += bitsCount;
+
+            uint64_t word{0};
+            // a whole word is loaded when it fits, otherwise only the bytes left; phrased so the optimizer can prove
+            // the word load unreachable for buffers shorter than a word:
+            const bool wholeWord = size_ >= sizeof(uint64_t) && byte <= size_ - sizeof(uint64_t);
+            const size_t loadedBytes = size_ - byte;
+            if constexpr (bitOrder == bit_order_t::msb_first)
+            {
+                if (wholeWord)
+                {
+                    std::memcpy(&word, data_ + byte, sizeof(word));
+                    word = toBigEndian(word);
+                }
+                else
+                {
+                    for (size_t i = 0; i < loadedBytes; ++i)
+                    {
+                        word |= static_cast<uint64_t>(data_[byte + i]) << (56 - 8 * i);
+                    }
+                }
+                return (word << shift) >> (64 - bitsCount);
+            }
+            else
+            {
+                if (wholeWord)
+                {
+                    std::memcpy(&word, data_ + byte, sizeof(word));
+                    word = toLittleEndian(word);
+                }
+                else
+                {
+                    for (size_t i = 0; i < loadedBytes; ++i)
+                    {
+                        word |= static_cast<uint64_t>(data_[byte + i]) << (8 * i);
+                    }
+                }
+                return (word >> shift) & detail::lowBitsMask(bitsCount);
+            }
+        }
+
+        const uint8_t *data_;
+        size_t size_;
+        size_t position_{0};
+    };
+}
@@ -0,0 +1,419 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./endianness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace toolbox::memory
+{
+    namespace detail
+    {
+        /// Bit-reflected generator polynomial of CRC-32 (ISO-HDLC, used by zlib, PNG, Ethernet).
+        inline constexpr uint32_t crc32Polynomial = 0xEDB88320u;
+
+        /// Bit-reflected generator polynomial of CRC-32C (Castagnoli, used by iSCSI, ext4, SSE4.2 crc32 instruction).
+        inline constexpr uint32_t crc32cPolynomial = 0x82F63B78u;
+
+        /// Bit-reflected generator polynomial of CRC-64 (ECMA-182, as used by XZ).
+        inline constexpr uint64_t crc64Polynomial = 0xC96C5795D7870F42u;
+
+        /// Build slicing-by-8 tables of the bit-reflected CRC: the k-th table holds CRC of the byte followed by k zero bytes.
+        template <typename T, T polynomial>
+        constexpr std::array<std::array<T, 256>, 8> makeCrcTables() noexcept
+        {
+            std::array<std::array<T, 256>, 8> tables{};
+            for (size_t byte = 0; byte < 256; ++byte)
+            {
+                auto crc = static_cast<T>(byte);
+                for (size_t bit = 0; bit < 8; ++bit)
+                {
+                    crc = static_cast<T>((crc & 1u) != 0 ? (crc >> 1u) ^ polynomial : crc >> 1u);
+                }
+                tables[0][byte] = crc;
+            }
+            for (size_t table = 1; table < 8; ++table)
+            {
+                for (size_t byte = 0; byte < 256; ++byte)
+                {
+                    const T previous = tables[table - 1][byte];
+                    tables[table][byte] = static_cast<T>((previous >> 8u) ^ tables[0][previous & 0xFFu]);
+                }
+            }
+            return tables;
+        }
+
+        template <typename T, T polynomial>
+        inline constexpr std::array<std::array<T, 256>, 8> crcTables = makeCrcTables<T, polynomial>();
+
+        /// Multiply two bit-reflected polynomials modulo the generator \p polynomial.
+        template <typename T, T polynomial>
+        constexpr T multiplyModulo(T first, T second) noexcept
+        {
+            T product{0};
+            for (T mask = T{1} << (std::numeric_limits<T>::digits - 1); mask != 0; mask = static_cast<T>(mask >> 1u))
+            {
+                if ((first & mask) != 0)
+                {
+                    product ^= second;
+                }
+                second = static_cast<T>((second & 1u) != 0 ? (second >> 1u) ^ polynomial : second >> 1u);
+            }
+            return product;
+        }
+
+        /// Compute x^exponent modulo the generator \p polynomial, bit-reflected.
+        template <typename T, T polynomial>
+        constexpr T powerModulo(uint64_t exponent) noexcept
+        {
+            T result = T{1} << (std::numeric_limits<T>::digits - 1);
+            T power = T{1} << (std::numeric_limits<T>::digits - 2);
+            while (exponent != 0)
+            {
+                if ((exponent & 1u) != 0)
+                {
+                    result = multiplyModulo<T, polynomial>(result, power);
+                }
+                power = multiplyModulo<T, polynomial>(power, power);
+                exponent >>= 1u;
+            }
+            return result;
+        }
+
+        /// Combine CRCs of two consecutive buffers; valid for CRCs with all-ones initial value and final xor.
+        template <typename T, T polynomial>
+        constexpr T combineCrc(T first, T second, uint64_t secondSize) noexcept
+        {
+            return multiplyModulo<T, polynomial>(powerModulo<T, polynomial>(8 * secondSize), first) ^ second;
+        }
+
+        /// Update raw (not inverted) state of the bit-reflected CRC with slicing-by-8 tables.
+        template <typename T, T polynomial>
+        T updateCrcWithTables(T state, const uint8_t *data, size_t size) noexcept
+        {
+            const auto &tables = crcTables<T, polynomial>;
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                word = toLittleEndian(word) ^ state;
+                state = static_cast<T>(tables[7][word & 0xFFu] ^ tables[6][(word >> 8u) & 0xFFu] ^
+                                       tables[5][(word >> 16u) & 0xFFu] ^ tables[4][(word >> 24u) & 0xFFu] ^
+                                       tables[3][(word >> 32u) & 0xFFu] ^ tables[2][(word >> 40u) & 0xFFu] ^
+                                       tables[1][(word >> 48u) & 0xFFu] ^ tables[0][word >> 56u]);
+            }
+            for (size_t i = 0; i < size; ++i)
+            {
+                state = static_cast<T>(tables[0][(state ^ data[i]) & 0xFFu] ^ (state >> 8u));
+            }
+            return state;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Check whether the CPU provides the SSE4.2 crc32 instruction.
+        inline bool hasCrc32Instruction() noexcept
+        {
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("sse4.2") != 0;
+            }();
+            return supported;
+        }
+
+        /// Check whether the CPU provides the PCLMULQDQ (carry-less multiplication) instruction.
+        inline bool hasCarrylessMultiplication() noexcept
+        {
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("pclmul") != 0;
+            }();
+            return supported;
+        }
+
+        /// Bit-reflected x^exponent modulo the generator \p polynomial, aligned to the top of a 64-bit word,
+        /// i.e. as a carry-less multiplication operand.
+        template <typename T, T polynomial>
+        constexpr uint64_t foldingConstant(uint64_t exponent) noexcept
+        {
+            return static_cast<uint64_t>(powerModulo<T, polynomial>(exponent)) << (64 - std::numeric_limits<T>::digits);
+        }
+
+        /// Move 128-bit block \p foldedBits further along the message, modulo the generator polynomial.
+        /// \remark The \p constants hold x^(foldedBits + 63) in the low half and x^(foldedBits - 1) in the high half,
+        /// as the low half of the block holds its leading (higher degree) bytes.
+        __attribute__((target("sse2,pclmul")))
+        inline __m128i foldBlock(__m128i block, __m128i constants) noexcept
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(block, constants, 0x00), _mm_clmulepi64_si128(block, constants, 0x11));
+        }
+
+        /// Update raw state of the bit-reflected CRC by folding 16-byte blocks with carry-less multiplication,
+        /// four independent blocks at a time; the final block is reduced with the tables.
+        /// \remark Requires at least 64 bytes of data.
+        template <typename T, T polynomial>
+        __attribute__((target("sse2,pclmul")))
+        T updateCrcWithFolding(T state, const uint8_t *data, size_t size) noexcept
+        {
+            constexpr uint64_t fold512Leading = foldingConstant<T, polynomial>(575);
+            constexpr uint64_t fold512Trailing = foldingConstant<T, polynomial>(511);
+            constexpr uint64_t fold128Leading = foldingConstant<T, polynomial>(191);
+            constexpr uint64_t fold128Trailing = foldingConstant<T, polynomial>(127);
+            const __m128i fold512 = _mm_set_epi64x(static_cast<long long>(fold512Trailing), static_cast<long long>(fold512Leading));
+            const __m128i fold128 = _mm_set_epi64x(static_cast<long long>(fold128Trailing), static_cast<long long>(fold128Leading));
+            const auto load = [](const uint8_t *block)
+            {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+            };
+
+            // the state is xored into the leading bytes of the message:
+            __m128i block0 = _mm_xor_si128(load(data), _mm_set_epi64x(0, static_cast<long long>(state)));
+            __m128i block1 = load(data + 16);
+            __m128i block2 = load(data + 32);
+            __m128i block3 = load(data + 48);
+            data += 64;
+            size -= 64;
+
+            for (; size >= 64; size -= 64, data += 64)
+            {
+                block0 = _mm_xor_si128(foldBlock(block0, fold512), load(data));
+                block1 = _mm_xor_si128(foldBlock(block1, fold512), load(data + 16));
+                block2 = _mm_xor_si128(foldBlock(block2, fold512), load(data + 32));
+                block3 = _mm_xor_si128(foldBlock(block3, fold512), load(data + 48));
+            }
+
+            __m128i folded = _mm_xor_si128(foldBlock(block0, fold128), block1);
+            folded = _mm_xor_si128(foldBlock(folded, fold128), block2);
+            folded = _mm_xor_si128(foldBlock(folded, fold128), block3);
+            for (; size >= 16; size -= 16, data += 16)
+            {
+                folded = _mm_xor_si128(foldBlock(folded, fold128), load(data));
+            }
+
+            // the folded block is congruent to the whole processed message:
+            std::array<uint8_t, 16> remainder{};
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder.data()), folded);
+            state = updateCrcWithTables<T, polynomial>(0, remainder.data(), remainder.size());
+            return updateCrcWithTables<T, polynomial>(state, data, size);
+        }
+
+        /// Shift raw state of the CRC-32C by \p bytesCount zero bytes, i.e. multiply it by x^(8 * bytesCount) modulo the polynomial.
+        /// \remark The carry-less product and the crc32 instruction contribute x^1 and x^32 respectively,
+        /// so the state is multiplied by x^(8 * bytesCount - 33) first.
+        template <size_t bytesCount>
+        __attribute__((target("sse4.2,pclmul")))
+        uint32_t shiftCrc32c(uint32_t state) noexcept
+        {
+            constexpr uint32_t shift = powerModulo<uint32_t, crc32cPolynomial>(8 * bytesCount - 33);
+            const __m128i product = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(state)),
+                                                         _mm_cvtsi32_si128(static_cast<int>(shift)), 0x00);
+            return static_cast<uint32_t>(_mm_crc32_u64(0, static_cast<uint64_t>(_mm_cvtsi128_si64(product))));
+        }
+
+        /// Update raw state of the CRC-32C with the SSE4.2 crc32 instruction.
+        /// \remark Long buffers are processed as three interleaved lanes, hiding the latency of the instruction;
+        /// lanes are joined by shifting their CRCs with shiftCrc32c.
+        __attribute__((target("sse4.2,pclmul")))
+        inline uint32_t updateCrc32cWithInstruction(uint32_t state, const uint8_t *data, size_t size) noexcept
+        {
+            constexpr size_t laneSize = 512;
+            const auto load = [](const uint8_t *word)
+            {
+                uint64_t value;
+                std::memcpy(&value, word, sizeof(value));
+                return value;
+            };
+
+            uint64_t crc = state;
+            for (; size >= 3 * laneSize; size -= 3 * laneSize, data += 3 * laneSize)
+            {
+                uint64_t crc1{0};
+                uint64_t crc2{0};
+                for (size_t i = 0; i < laneSize; i += 8)
+                {
+                    crc = _mm_crc32_u64(crc, load(data + i));
+                    crc1 = _mm_crc32_u64(crc1, load(data + laneSize + i));
+                    crc2 = _mm_crc32_u64(crc2, load(data + 2 * laneSize + i));
+                }
+                crc = shiftCrc32c<laneSize>(shiftCrc32c<laneSize>(static_cast<uint32_t>(crc)) ^ static_cast<uint32_t>(crc1)) ^ crc2;
+            }
+
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                crc = _mm_crc32_u64(crc, load(data));
+            }
+            auto crc32 = static_cast<uint32_t>(crc);
+            for (size_t i = 0; i < size; ++i)
+            {
+                crc32 = _mm_crc32_u8(crc32, data[i]);
+            }
+            return crc32;
+        }
+#endif
+
+        /// Update raw state of the bit-reflected CRC, using carry-less multiplication folding when available.
+        template <typename T, T polynomial>
+        T updateCrc(T state, const uint8_t *data, size_t size) noexcept
+        {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (size >= 64 && hasCarrylessMultiplication())
+            {
+                return updateCrcWithFolding<T, polynomial>(state, data, size);
+            }
+#endif
+            return updateCrcWithTables<T, polynomial>(state, data, size);
+        }
+    }
+
+    /// Compute CRC-32 (ISO-HDLC: polynomial 0x04C11DB7, reflected, as used by zlib, PNG and Ethernet).
+    /// \param data Checksummed data.
+    /// \param size Size of the \p data in bytes.
+    /// \param crc CRC of the preceding data, to continue the computation; 0 for the beginning of the data.
+    /// \return CRC of the data; crc32 of "123456789" is 0xCBF43926.
+    /// \remark Uses PCLMULQDQ folding when the CPU supports it (detected at runtime), slicing-by-8 tables otherwise.
+    inline uint32_t crc32(const uint8_t *data, size_t size, uint32_t crc = 0) noexcept
+    {
+        return ~detail::updateCrc<uint32_t, detail::crc32Polynomial>(~crc, data, size);
+    }
+
+    /// Compute CRC-32C (Castagnoli: polynomial 0x1EDC6F41, reflected, as used by iSCSI, ext4 and SCTP).
+    /// \param data Checksummed data.
+    /// \param size Size of the \p data in bytes.
+    /// \param crc CRC of the preceding data, to continue the computation; 0 for the beginning of the data.
+    /// \return CRC of the data; crc32c of "123456789" is 0xE3069283.
+    /// \remark Uses the SSE4.2 crc32 instruction when the CPU supports it (detected at runtime), slicing-by-8 tables otherwise.
+    inline uint32_t crc32c(const uint8_t *data, size_t size, uint32_t crc = 0) noexcept
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if (detail::hasCrc32Instruction() && detail::hasCarrylessMultiplication())
+        {
+            return ~detail::updateCrc32cWithInstruction(~crc, data, size);
+        }
+#endif
+        return ~detail::updateCrcWithTables<uint32_t, detail::crc32cPolynomial>(~crc, data, size);
+    }
+
+    /// Compute CRC-64 (ECMA-182 polynomial, reflected, as used by XZ).
+    /// \param data Checksummed data.
+    /// \param size Size of the \p data in bytes.
+    /// \param crc CRC of the preceding data, to continue the computation; 0 for the beginning of the data.
+    /// \return CRC of the data; crc64 of "123456789" is 0x995DC9BBDF1939FA.
+    /// \remark Uses PCLMULQDQ folding when the CPU supports it (detected at runtime), slicing-by-8 tables otherwise.
+    inline uint64_t crc64(const uint8_t *data, size_t size, uint64_t crc = 0) noexcept
+    {
+        return ~detail::updateCrc<uint64_t, detail::crc64Polynomial>(~crc, data, size);
+    }
+
+    /// Compute CRC-32 of concatenation of two buffers from their CRCs, e.g. to join checksums of chunks computed in parallel.
+    /// \param first CRC-32 of the first buffer.
+    /// \param second CRC-32 of the second buffer.
+    /// \param secondSize Size of the second buffer in bytes.
+    /// \return CRC-32 of the first buffer followed by the second one.
+    constexpr uint32_t crc32Combine(uint32_t first, uint32_t second, uint64_t secondSize) noexcept
+    {
+        return detail::combineCrc<uint32_t, detail::crc32Polynomial>(first, second, secondSize);
+    }
+
+    /// Compute CRC-32C of concatenation of two buffers from their CRCs, e.g. to join checksums of chunks computed in parallel.
+    /// \param first CRC-32C of the first buffer.
+    /// \param second CRC-32C of the second buffer.
+    /// \param secondSize Size of the second buffer in bytes.
+    /// \return CRC-32C of the first buffer followed by the second one.
+    constexpr uint32_t crc32cCombine(uint32_t first, uint32_t second, uint64_t secondSize) noexcept
+    {
+        return detail::combineCrc<uint32_t, detail::crc32cPolynomial>(first, second, secondSize);
+    }
+
+    /// Compute CRC-64 of concatenation of two buffers from their CRCs, e.g. to join checksums of chunks computed in parallel.
+    /// \param first CRC-64 of the first buffer.
+    /// \param second CRC-64 of the second buffer.
+    /// \param secondSize Size of the second buffer in bytes.
+    /// \return CRC-64 of the first buffer followed by the second one.
+    constexpr uint64_t crc64Combine(uint64_t first, uint64_t second, uint64_t secondSize) noexcept
+    {
+        return detail::combineCrc<uint64_t, detail::crc64Polynomial>(first, second, secondSize);
+    }
+
+    /// Compute Adler-32 checksum (as used by zlib) - much cheaper than CRC, at the cost of weaker error detection.
+    /// \param data Checksummed data.
+    /// \param size Size of the \p data in bytes.
+    /// \param adler Checksum of the preceding data, to continue the computation; 1 for the beginning of the data.
+    /// \return Checksum of the data; adler32 of "123456789" is 0x091E01DE.
+    /// \remark The modulo is deferred to every 5552 bytes, the most that can't overflow 32-bit sums.
+    inline uint32_t adler32(const uint8_t *data, size_t size, uint32_t adler = 1) noexcept
+    {
+        constexpr uint32_t modulo = 65521;
+        constexpr size_t maxBlockSize = 5552;
+
+        uint32_t sum = adler & 0xFFFFu;
+        uint32_t sumOfSums = adler >> 16u;
+        while (size > 0)
+        {
+            const size_t blockSize = std::min(size, maxBlockSize);
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                sum += data[i];
+                sumOfSums += sum;
+            }
+            sum %= modulo;
+            sumOfSums %= modulo;
+            data += blockSize;
+            size -= blockSize;
+        }
+        return (sumOfSums << 16u) | sum;
+    }
+
+    /// Compute Adler-32 checksum of concatenation of two buffers from their checksums.
+    /// \param first Checksum of the first buffer.
+    /// \param second Checksum of the second buffer.
+    /// \param secondSize Size of the second buffer in bytes.
+    /// \return Checksum of the first buffer followed by the second one.
+    constexpr uint32_t adler32Combine(uint32_t first, uint32_t second, uint64_t secondSize) noexcept
+    {
+        constexpr uint32_t modulo = 65521;
+
+        const auto remainder = static_cast<uint32_t>(secondSize % modulo);
+        uint32_t sum = first & 0xFFFFu;
+        uint32_t sumOfSums = static_cast<uint32_t>((uint64_t{remainder} * sum) % modulo);
+        sum += (second & 0xFFFFu) + modulo - 1;
+        sumOfSums += (first >> 16u) + (second >> 16u) + modulo - remainder;
+        sum = sum >= modulo ? sum - modulo : sum;
+        sum = sum >= modulo ? sum - modulo : sum;
+        sumOfSums = sumOfSums >= 2 * modulo ? sumOfSums - 2 * modulo : sumOfSums;
+        sumOfSums = sumOfSums >= modulo ? sumOfSums - modulo : sumOfSums;
+        return (sumOfSums << 16u) | sum;
+    }
+}
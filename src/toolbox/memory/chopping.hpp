@@ -31,6 +31,7 @@
 #include <limits>
 #include <type_traits>
 #include <array>
+#include <cstring>
 
 namespace toolbox::memory
 {
@@ -83,5 +84,326 @@ namespace toolbox::memory
         return slices;
     }
 
+    /// Slices bit form of all integer values from \p values to smaller chunks, written one after another to \p destination.
+    /// \example Slicing {0xBEEF, 0xDEAD} of \p uint16_t to \p uint8_t in big endian order gives {0xBE, 0xEF, 0xDE, 0xAD}.
+    /// \tparam SmallerType A destination type of chunk.
+    /// \tparam order Order of chunks of each value: big (most significant first, same as single value sliceToChunks) or little.
+    /// \tparam BiggerType Source type to be divided.
+    /// \param values Values to be sliced.
+    /// \param count Number of \p values.
+    /// \param destination Output buffer, should have room for count * sizeof(BiggerType) / sizeof(SmallerType) chunks.
+    /// \return Pointer past the last written chunk.
+    /// \remark The order is resolved at compile time: matching the CPU order it is a plain copy, otherwise a byte swap loop
+    /// which compilers turn into vector shuffles.
+    template <typename SmallerType, endianness_t order = endianness_t::big, typename BiggerType>
+    SmallerType *sliceToChunks(const BiggerType *values, size_t count, SmallerType *destination)
+    {
+        constexpr size_t slices_count = std::numeric_limits<BiggerType>::digits / std::numeric_limits<SmallerType>::digits;
+
+        // initial assumptions:
+        static_assert(slices_count > 1, "BiggerType should be wider than 'SmallerType'.");
+        static_assert(std::is_integral<BiggerType>::value, "'BiggerType' should be fundamental integral type.");
+        static_assert(!std::is_same<BiggerType, bool>::value, "'BiggerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<BiggerType>::value, "'BiggerType' should not store the sign bit.");
+
+        static_assert(std::is_integral<SmallerType>::value, "'SmallerType' should be fundamental integral type.");
+        static_assert(!std::is_same<SmallerType, bool>::value, "'SmallerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<SmallerType>::value, "'SmallerType' should not store the sign bit.");
+
+        static_assert(order != endianness_t::unknown, "'order' should be either big or little.");
+
+        if constexpr (order == get_endianness())
+        {
+            if (count > 0)
+            {
+                std::memcpy(destination, values, count * sizeof(BiggerType));
+            }
+        }
+        else if constexpr (sizeof(SmallerType) == 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const BiggerType swapped = byteswap(values[i]);
+                std::memcpy(destination + i * sizeof(BiggerType), &swapped, sizeof(BiggerType));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (size_t slice = 0; slice < slices_count; ++slice)
+                {
+                    const size_t shift = (order == endianness_t::big ? slices_count - 1 - slice : slice) * std::numeric_limits<SmallerType>::digits;
+                    destination[i * slices_count + slice] = static_cast<SmallerType>(values[i] >> shift);
+                }
+            }
+        }
+        return destination + count * slices_count;
+    }
+
+    /// Joins chunks of integer value back into the single wider value - inverse of sliceToChunks.
+    /// \example Joining {0xBE, 0xEF} array of \p uint8_t to \p uint16_t will give us 0xBEEF value.
+    /// \tparam BiggerType A destination type to be assembled.
+    /// \tparam SmallerType Type of chunks.
+    /// \tparam slices_count Size of the chunks array, should match the width of \p BiggerType.
+    /// \param chunks Chunks of the value, the most significant first.
+    /// \return Assembled value.
+    template <typename BiggerType, typename SmallerType, size_t slices_count>
+    constexpr BiggerType joinChunks(const std::array<SmallerType, slices_count> &chunks)
+    {
+        // initial assumptions:
+        static_assert(std::is_integral<BiggerType>::value, "'BiggerType' should be fundamental integral type.");
+        static_assert(!std::is_same<BiggerType, bool>::value, "'BiggerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<BiggerType>::value, "'BiggerType' should not store the sign bit.");
+
+        static_assert(std::is_integral<SmallerType>::value, "'SmallerType' should be fundamental integral type.");
+        static_assert(!std::is_same<SmallerType, bool>::value, "'SmallerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<SmallerType>::value, "'SmallerType' should not store the sign bit.");
+
+        static_assert(slices_count > 1, "BiggerType should be wider than 'SmallerType'.");
+        static_assert(slices_count == std::numeric_limits<BiggerType>::digits / std::numeric_limits<SmallerType>::digits,
+                      "Chunks should fill exactly whole 'BiggerType'.");
+
+        BiggerType value{0};
+        for (const auto chunk : chunks)
+        {
+            value = static_cast<BiggerType>((value << std::numeric_limits<SmallerType>::digits) | chunk);
+        }
+        return value;
+    }
+
+    /// Joins chunks from \p chunks buffer into \p count wider integer values - inverse of bulk sliceToChunks.
+    /// \example Joining {0xBE, 0xEF, 0xDE, 0xAD} of \p uint8_t to \p uint16_t in big endian order gives {0xBEEF, 0xDEAD}.
+    /// \tparam BiggerType A destination type to be assembled.
+    /// \tparam order Order of chunks of each value: big (most significant first, same as joinChunks of array) or little.
+    /// \tparam SmallerType Type of chunks.
+    /// \param chunks Chunks of consecutive values, count * sizeof(BiggerType) / sizeof(SmallerType) of them.
+    /// \param count Number of values to be assembled.
+    /// \param destination Output buffer, should have room for \p count values.
+    /// \return Pointer past the last consumed chunk.
+    /// \remark The order is resolved at compile time: matching the CPU order it is a plain copy, otherwise a byte swap loop
+    /// which compilers turn into vector shuffles.
+    template <typename BiggerType, endianness_t order = endianness_t::big, typename SmallerType>
+    const SmallerType *joinChunks(const SmallerType *chunks, size_t count, BiggerType *destination)
+    {
+        constexpr size_t slices_count = std::numeric_limits<BiggerType>::digits / std::numeric_limits<SmallerType>::digits;
+
+        // initial assumptions:
+        static_assert(slices_count > 1, "BiggerType should be wider than 'SmallerType'.");
+        static_assert(std::is_integral<BiggerType>::value, "'BiggerType' should be fundamental integral type.");
+        static_assert(!std::is_same<BiggerType, bool>::value, "'BiggerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<BiggerType>::value, "'BiggerType' should not store the sign bit.");
 
+        static_assert(std::is_integral<SmallerType>::value, "'SmallerType' should be fundamental integral type.");
+        static_assert(!std::is_same<SmallerType, bool>::value, "'SmallerType' should not be the boolean type.");
+        static_assert(std::is_unsigned<SmallerType>::value, "'SmallerType' should not store the sign bit.");
+
+        static_assert(order != endianness_t::unknown, "'order' should be either big or little.");
+
+        if constexpr (order == get_endianness())
+        {
+            if (count > 0)
+            {
+                std::memcpy(destination, chunks, count * sizeof(BiggerType));
+            }
+        }
+        else if constexpr (sizeof(SmallerType) == 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                BiggerType value{};
+                std::memcpy(&value, chunks + i * sizeof(BiggerType), sizeof(BiggerType));
+                destination[i] = byteswap(value);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                BiggerType value{0};
+                for (size_t slice = 0; slice < slices_count; ++slice)
+                {
+                    const size_t shift = (order == endianness_t::big ? slices_count - 1 - slice : slice) * std::numeric_limits<SmallerType>::digits;
+                    value = static_cast<BiggerType>(value | (static_cast<BiggerType>(chunks[i * slices_count + slice]) << shift));
+                }
+                destination[i] = value;
+            }
+        }
+        return chunks + count * slices_count;
+    }
+
+    namespace detail
+    {
+        /// Store the lowest \p bytesCount bytes of \p word in little endian order.
+        inline void storeLittleEndianBytes(uint64_t word, uint8_t *destination, size_t bytesCount) noexcept
+        {
+            for (size_t i = 0; i < bytesCount; ++i)
+            {
+                destination[i] = static_cast<uint8_t>(word >> (8 * i));
+            }
+        }
+
+        /// Load \p bytesCount (up to 8) bytes stored in little endian order.
+        inline uint64_t loadLittleEndianBytes(const uint8_t *source, size_t bytesCount) noexcept
+        {
+            uint64_t word{0};
+            for (size_t i = 0; i < bytesCount; ++i)
+            {
+                word |= static_cast<uint64_t>(source[i]) << (8 * i);
+            }
+            return word;
+        }
+    }
+
+    /// Calculate number of bytes needed to pack \p count values of \p width bits.
+    /// \tparam width Number of bits of each value, 1 - 64.
+    /// \param count Number of values.
+    /// \return Size of the packed data in bytes.
+    template <size_t width>
+    constexpr size_t packedSize(size_t count) noexcept
+    {
+        static_assert(width >= 1 && width <= 64, "'width' should be in range 1 - 64.");
+        return (count * width + 7) / 8;
+    }
+
+    /// Pack the lowest \p width bits of each value into a dense bit stream, generalizing sliceToChunks to any width.
+    /// \example Packing {0xABC, 0x123} with width 12 gives bytes {0xBC, 0x3A, 0x12}.
+    /// \remark Value i occupies bits [i * width, (i + 1) * width) of the stream, bytes are filled starting from the least significant bit.
+    /// A separate kernel is generated for each \p width, so all shifts and masks are compile time constants.
+    /// \tparam width Number of bits of each value, 1 - 64. Higher bits of values are ignored.
+    /// \param values Values to be packed.
+    /// \param count Number of \p values.
+    /// \param destination Output buffer, should have room for packedSize<width>(count) bytes.
+    /// \return Number of bytes written.
+    template <size_t width>
+    size_t packBits(const uint64_t *values, size_t count, uint8_t *destination) noexcept
+    {
+        static_assert(width >= 1 && width <= 64, "'width' should be in range 1 - 64.");
+        constexpr uint64_t mask = width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+
+        uint64_t accumulator{0};
+        size_t bits{0};
+        uint8_t *current = destination;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t value = values[i] & mask;
+            accumulator |= value << bits;
+            bits += width;
+            if (bits >= 64)
+            {
+                detail::storeLittleEndianBytes(accumulator, current, 8);
+                current += 8;
+                bits -= 64;
+                accumulator = bits == 0 ? 0 : value >> (width - bits);
+            }
+        }
+
+        const size_t tailBytes = (bits + 7) / 8;
+        detail::storeLittleEndianBytes(accumulator, current, tailBytes);
+        return static_cast<size_t>(current - destination) + tailBytes;
+    }
+
+    namespace detail
+    {
+        /// Scalar kernel of unpackBits, reading the stream word by word.
+        template <size_t width>
+        void unpackBitsScalar(const uint8_t *packed, size_t count, uint64_t *destination) noexcept
+        {
+            constexpr uint64_t mask = width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+
+            const uint8_t *const end = packed + packedSize<width>(count);
+            uint64_t accumulator{0};
+            size_t bits{0};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (bits >= width)
+                {
+                    destination[i] = accumulator & mask;
+                    if constexpr (width == 64)
+                    {
+                        accumulator = 0;
+                    }
+                    else
+                    {
+                        accumulator >>= width;
+                    }
+                    bits -= width;
+                    continue;
+                }
+
+                const auto loadedBytes = std::min<size_t>(8, static_cast<size_t>(end - packed));
+                const uint64_t next = loadLittleEndianBytes(packed, loadedBytes);
+                packed += loadedBytes;
+
+                const size_t usedBits = width - bits;
+                destination[i] = (accumulator | (next << bits)) & mask;
+                accumulator = usedBits == 64 ? 0 : next >> usedBits;
+                bits = 8 * loadedBytes - usedBits;
+            }
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// AVX2 kernel of unpackBits for widths up to 57 bits, 8 values (\p width bytes of the stream) per iteration.
+        /// Each value is gathered as a 64-bit word starting at the byte holding its first bit, then shifted right by the offset
+        /// of that bit in the byte - up to 7 bits, so the whole value is always in the word.
+        /// \return Number of unpacked values, a multiple of 8 - so the rest starts at a byte boundary and is left for the scalar code.
+        template <size_t width>
+        __attribute__((target("avx2")))
+        size_t unpackBitsAvx2(const uint8_t *packed, size_t count, uint64_t *destination) noexcept
+        {
+            static_assert(width <= 57, "values wider than 57 bits don't fit a word loaded from their first byte.");
+            constexpr auto offset = [](size_t index)
+            {
+                return static_cast<long long>(index * width);
+            };
+            const __m256i firstOffsets = _mm256_setr_epi64x(offset(0), offset(1), offset(2), offset(3));
+            const __m256i secondOffsets = _mm256_setr_epi64x(offset(4), offset(5), offset(6), offset(7));
+            const __m256i firstBytes = _mm256_srli_epi64(firstOffsets, 3);
+            const __m256i secondBytes = _mm256_srli_epi64(secondOffsets, 3);
+            const __m256i firstShifts = _mm256_and_si256(firstOffsets, _mm256_set1_epi64x(7));
+            const __m256i secondShifts = _mm256_and_si256(secondOffsets, _mm256_set1_epi64x(7));
+            const __m256i mask = _mm256_set1_epi64x(static_cast<long long>((uint64_t{1} << width) - 1));
+
+            // the word of the last value in a group is loaded from its byte (7 * width / 8), it has to fit in the stream:
+            const size_t size = packedSize<width>(count);
+            size_t unpacked{0};
+            for (size_t group = 0; unpacked + 8 <= count && group + 7 * width / 8 + 8 <= size; group += width, unpacked += 8)
+            {
+                const auto *base = reinterpret_cast<const long long *>(packed + group);
+                const __m256i first = _mm256_srlv_epi64(_mm256_i64gather_epi64(base, firstBytes, 1), firstShifts);
+                const __m256i second = _mm256_srlv_epi64(_mm256_i64gather_epi64(base, secondBytes, 1), secondShifts);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + unpacked), _mm256_and_si256(first, mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + unpacked + 4), _mm256_and_si256(second, mask));
+            }
+            return unpacked;
+        }
+#endif
+    }
+
+    /// Unpack values of \p width bits from the bit stream written by packBits.
+    /// \remark A separate kernel is generated for each \p width, so all shifts and masks are compile time constants.
+    /// Widths up to 57 bits are unpacked with AVX2 gathers when the CPU supports them (detected at runtime), 8 values at once.
+    /// \tparam width Number of bits of each value, 1 - 64.
+    /// \param packed Packed data, packedSize<width>(count) bytes.
+    /// \param count Number of values to be unpacked.
+    /// \param destination Output buffer, should have room for \p count values.
+    template <size_t width>
+    void unpackBits(const uint8_t *packed, size_t count, uint64_t *destination) noexcept
+    {
+        static_assert(width >= 1 && width <= 64, "'width' should be in range 1 - 64.");
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if constexpr (width <= 57)
+        {
+            if (count >= 16 && detail::hasAvx2())
+            {
+                const size_t unpacked = detail::unpackBitsAvx2<width>(packed, count, destination);
+                packed += unpacked / 8 * width;
+                destination += unpacked;
+                count -= unpacked;
+            }
+        }
+#endif
+        detail::unpackBitsScalar<width>(packed, count, destination);
+    }
 }
@@ -24,9 +24,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
 namespace toolbox::memory
 {
@@ -38,11 +45,29 @@ namespace toolbox::memory
         little
     };
 
-    /// Function which recognize current machine byte order by doing some bit shifting operations.
+    /// Function which recognize current machine byte order from the compiler predefined macros.
     /// \remark Could be use in a constexpr context.
+    /// \remark Uses __BYTE_ORDER__ (GCC, Clang) and assumes little endian on MSVC; other compilers fall back to bit shifting,
+    /// which can't inspect the memory layout in a constant expression and reports little endian - use test_endianness() there.
     /// \return Byte order of the current CPU.
     constexpr endianness_t get_endianness()
     {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && defined(__ORDER_LITTLE_ENDIAN__)
+        if constexpr (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        {
+            return endianness_t::big;
+        }
+        else if constexpr (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        {
+            return endianness_t::little;
+        }
+        else
+        {
+            return endianness_t::unknown;
+        }
+#elif defined(_MSC_VER)
+        return endianness_t::little;
+#else
         // write tested value to the memory:
         constexpr uint16_t pattern = 0xDEADu;
         constexpr auto first_byte = static_cast<uint8_t>(pattern >> static_cast<size_t>(std::numeric_limits<uint8_t>::digits) & std::numeric_limits<uint8_t>::max());
@@ -59,6 +84,7 @@ namespace toolbox::memory
         {
             return endianness_t::unknown;
         }
+#endif
     }
 
     /// Function which recognize current machine byte order by reading chunks of memory.
@@ -93,4 +119,317 @@ namespace toolbox::memory
             return endianness_t::unknown;
         }
     }
+
+    namespace detail
+    {
+        /// Unsigned integral type of the given size in bytes.
+        template <size_t size> struct unsigned_of_size;
+        template <> struct unsigned_of_size<1> { using type = uint8_t; };
+        template <> struct unsigned_of_size<2> { using type = uint16_t; };
+        template <> struct unsigned_of_size<4> { using type = uint32_t; };
+        template <> struct unsigned_of_size<8> { using type = uint64_t; };
+
+        /// Reverse order of bytes of unsigned integral \p value.
+        template <typename T>
+        constexpr T byteswapUnsigned(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                return value;
+            }
+#if defined(__GNUC__) || defined(__clang__)
+            else if constexpr (sizeof(T) == 2)
+            {
+                return static_cast<T>(__builtin_bswap16(value));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                return static_cast<T>(__builtin_bswap32(value));
+            }
+            else if constexpr (sizeof(T) == 8)
+            {
+                return static_cast<T>(__builtin_bswap64(value));
+            }
+#endif
+            else
+            {
+                T swapped{0};
+                for (size_t i = 0; i < sizeof(T); ++i)
+                {
+                    swapped = static_cast<T>((swapped << 8u) | (value & 0xFFu));
+                    value = static_cast<T>(value >> 8u);
+                }
+                return swapped;
+            }
+        }
+
+        /// Reverse order of bytes in each of \p count elements of \p elementSize bytes, stored at \p bytes.
+        template <size_t elementSize>
+        void byteswapElementsScalar(uint8_t *bytes, size_t count) noexcept
+        {
+            using Unsigned = typename unsigned_of_size<elementSize>::type;
+            for (size_t i = 0; i < count; ++i)
+            {
+                Unsigned bits{};
+                std::memcpy(&bits, bytes + i * elementSize, elementSize);
+                bits = byteswapUnsigned(bits);
+                std::memcpy(bytes + i * elementSize, &bits, elementSize);
+            }
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Check whether the CPU provides AVX2 instructions.
+        inline bool hasAvx2() noexcept
+        {
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return supported;
+        }
+
+        /// Shuffle indices reversing bytes of each \p elementSize-byte element within a 128-bit lane.
+        template <size_t elementSize>
+        inline constexpr std::array<uint8_t, 32> byteswapShuffle = []
+        {
+            std::array<uint8_t, 32> indices{};
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                indices[i] = static_cast<uint8_t>(i % 16 - i % elementSize + elementSize - 1 - i % elementSize);
+            }
+            return indices;
+        }();
+
+        /// AVX2 version of byteswapElementsScalar, converting 128 bytes per iteration with vpshufb.
+        /// \return Number of converted elements; the rest (less than 32 bytes) is left for the scalar code.
+        template <size_t elementSize>
+        __attribute__((target("avx2")))
+        size_t byteswapElementsAvx2(uint8_t *bytes, size_t count) noexcept
+        {
+            const __m256i reverse = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(byteswapShuffle<elementSize>.data()));
+            const size_t size = count * elementSize;
+            auto *vectors = reinterpret_cast<__m256i *>(bytes);
+
+            size_t i{0};
+            for (; i + 4 * sizeof(__m256i) <= size; i += 4 * sizeof(__m256i), vectors += 4)
+            {
+                const __m256i first = _mm256_shuffle_epi8(_mm256_loadu_si256(vectors), reverse);
+                const __m256i second = _mm256_shuffle_epi8(_mm256_loadu_si256(vectors + 1), reverse);
+                const __m256i third = _mm256_shuffle_epi8(_mm256_loadu_si256(vectors + 2), reverse);
+                const __m256i fourth = _mm256_shuffle_epi8(_mm256_loadu_si256(vectors + 3), reverse);
+                _mm256_storeu_si256(vectors, first);
+                _mm256_storeu_si256(vectors + 1, second);
+                _mm256_storeu_si256(vectors + 2, third);
+                _mm256_storeu_si256(vectors + 3, fourth);
+            }
+            for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i), ++vectors)
+            {
+                _mm256_storeu_si256(vectors, _mm256_shuffle_epi8(_mm256_loadu_si256(vectors), reverse));
+            }
+            return i / elementSize;
+        }
+#endif
+    }
+
+    /// Reverse order of bytes in the \p value.
+    /// \remark Compiles to a single bswap (or rev) instruction on GCC and Clang.
+    /// \remark Could be used in a constexpr context for integral types only.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param value Value to be converted.
+    /// \return Value with reversed byte order.
+    template <typename T>
+    constexpr T byteswap(T value) noexcept
+    {
+        static_assert(std::is_arithmetic<T>::value, "'T' should be fundamental arithmetic type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        if constexpr (std::is_integral<T>::value)
+        {
+            using Unsigned = std::make_unsigned_t<T>;
+            return static_cast<T>(detail::byteswapUnsigned(static_cast<Unsigned>(value)));
+        }
+        else
+        {
+            static_assert(std::numeric_limits<T>::is_iec559, "'T' should be IEEE floating point type.");
+            using Unsigned = typename detail::unsigned_of_size<sizeof(T)>::type;
+            Unsigned bits{};
+            std::memcpy(&bits, &value, sizeof(T));
+            bits = detail::byteswapUnsigned(bits);
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+    }
+
+    /// Convert \p value from the CPU byte order to the big endian order (and back - the conversion is symmetric).
+    /// \remark No-op on big endian CPU, resolved at compile time.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param value Value to be converted.
+    /// \return Converted value.
+    template <typename T>
+    constexpr T toBigEndian(T value) noexcept
+    {
+        if constexpr (get_endianness() == endianness_t::big)
+        {
+            return value;
+        }
+        else
+        {
+            return byteswap(value);
+        }
+    }
+
+    /// Convert \p value from the CPU byte order to the little endian order (and back - the conversion is symmetric).
+    /// \remark No-op on little endian CPU, resolved at compile time.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param value Value to be converted.
+    /// \return Converted value.
+    template <typename T>
+    constexpr T toLittleEndian(T value) noexcept
+    {
+        if constexpr (get_endianness() == endianness_t::little)
+        {
+            return value;
+        }
+        else
+        {
+            return byteswap(value);
+        }
+    }
+
+    /// Convert \p value from the CPU byte order to the given \p order (and back - the conversion is symmetric).
+    /// \tparam order Requested byte order, either big or little.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param value Value to be converted.
+    /// \return Converted value.
+    template <endianness_t order, typename T>
+    constexpr T toEndianness(T value) noexcept
+    {
+        static_assert(order != endianness_t::unknown, "'order' should be either big or little.");
+        if constexpr (order == endianness_t::big)
+        {
+            return toBigEndian(value);
+        }
+        else
+        {
+            return toLittleEndian(value);
+        }
+    }
+
+    /// Reverse order of bytes in each element of the \p data buffer.
+    /// \remark Uses AVX2 byte shuffles (vpshufb) when the CPU supports them (detected at runtime), bswap loop otherwise.
+    /// Buffers exceeding the caches are converted at the memory bandwidth either way; the shuffles pay off for the cached ones.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param data Buffer to be converted in place.
+    /// \param count Number of elements in the \p data buffer.
+    template <typename T>
+    void byteswapInPlace([[maybe_unused]] T *data, [[maybe_unused]] size_t count) noexcept
+    {
+        static_assert(std::is_arithmetic<T>::value, "'T' should be fundamental arithmetic type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        if constexpr (sizeof(T) > 1)
+        {
+            auto *bytes = reinterpret_cast<uint8_t *>(data);
+            size_t swapped{0};
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (count * sizeof(T) >= 32 && detail::hasAvx2())
+            {
+                swapped = detail::byteswapElementsAvx2<sizeof(T)>(bytes, count);
+            }
+#endif
+            detail::byteswapElementsScalar<sizeof(T)>(bytes + swapped * sizeof(T), count - swapped);
+        }
+    }
+
+    /// Convert each element of the \p data buffer from the CPU byte order to the big endian order (and back).
+    /// \remark No-op on big endian CPU, resolved at compile time.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param data Buffer to be converted in place.
+    /// \param count Number of elements in the \p data buffer.
+    template <typename T>
+    void toBigEndianInPlace([[maybe_unused]] T *data, [[maybe_unused]] size_t count) noexcept
+    {
+        if constexpr (get_endianness() != endianness_t::big)
+        {
+            byteswapInPlace(data, count);
+        }
+    }
+
+    /// Convert each element of the \p data buffer from the CPU byte order to the little endian order (and back).
+    /// \remark No-op on little endian CPU, resolved at compile time.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \param data Buffer to be converted in place.
+    /// \param count Number of elements in the \p data buffer.
+    template <typename T>
+    void toLittleEndianInPlace([[maybe_unused]] T *data, [[maybe_unused]] size_t count) noexcept
+    {
+        if constexpr (get_endianness() != endianness_t::little)
+        {
+            byteswapInPlace(data, count);
+        }
+    }
+
+    /// Storage of a value of type \p T kept in memory in the given byte order, regardless of the CPU byte order.
+    /// \remark Trivially copyable, with size of \p T and alignment 1, so it could be used for fields of packed wire structs
+    /// overlaid directly on received buffers. Each access converts the value with a single (possibly no-op) byte swap.
+    /// \tparam T Integral or IEEE floating point type.
+    /// \tparam order Byte order of the stored value.
+    template <typename T, endianness_t order>
+    class endian_value
+    {
+        static_assert(std::is_arithmetic<T>::value, "'T' should be fundamental arithmetic type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+        static_assert(order != endianness_t::unknown, "'order' should be either big or little.");
+
+    public:
+        using value_type = T;
+
+        constexpr endian_value() noexcept = default;
+
+        /// Store the \p value in the \p order byte order.
+        endian_value(T value) noexcept
+        {
+            store(value);
+        }
+
+        /// Store the \p value in the \p order byte order.
+        endian_value &operator=(T value) noexcept
+        {
+            store(value);
+            return *this;
+        }
+
+        /// Load the stored value in the CPU byte order.
+        operator T() const noexcept
+        {
+            return load();
+        }
+
+        /// Load the stored value in the CPU byte order.
+        T load() const noexcept
+        {
+            T value{};
+            std::memcpy(&value, bytes_.data(), sizeof(T));
+            return toEndianness<order>(value);
+        }
+
+        /// Store the \p value in the \p order byte order.
+        void store(T value) noexcept
+        {
+            value = toEndianness<order>(value);
+            std::memcpy(bytes_.data(), &value, sizeof(T));
+        }
+
+    private:
+        std::array<uint8_t, sizeof(T)> bytes_{};
+    };
+
+    /// Value of type \p T stored in the big endian (network) byte order.
+    template <typename T>
+    using big_endian = endian_value<T, endianness_t::big>;
+
+    /// Value of type \p T stored in the little endian byte order.
+    template <typename T>
+    using little_endian = endian_value<T, endianness_t::little>;
 }
@@ -0,0 +1,171 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include "./endianness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+
+namespace toolbox::memory
+{
+    namespace detail
+    {
+        /// Class and member types of a pointer to data member.
+        template <typename MemberPointer>
+        struct member_pointer_traits;
+
+        template <class Class, typename Member>
+        struct member_pointer_traits<Member Class::*>
+        {
+            using class_type = Class;
+            using member_type = Member;
+        };
+
+        /// Underlying arithmetic type of the schema field - the type itself or the underlying type of enumeration.
+        template <typename T, bool = std::is_enum<T>::value>
+        struct schema_field_type
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct schema_field_type<T, true>
+        {
+            using type = std::underlying_type_t<T>;
+        };
+
+        /// Write single schema field in the given byte order.
+        template <endianness_t order, typename T>
+        void storeSchemaField(const T &field, uint8_t *destination) noexcept
+        {
+            using Stored = typename schema_field_type<T>::type;
+            static_assert(std::is_arithmetic<Stored>::value, "Schema fields should be arithmetic or enumeration types.");
+            static_assert(!std::is_same<std::remove_cv_t<Stored>, bool>::value, "Schema fields should not be of the boolean type.");
+
+            const Stored value = toEndianness<order>(static_cast<Stored>(field));
+            std::memcpy(destination, &value, sizeof(Stored));
+        }
+
+        /// Read single schema field stored in the given byte order.
+        template <endianness_t order, typename T>
+        void loadSchemaField(T &field, const uint8_t *source) noexcept
+        {
+            using Stored = typename schema_field_type<T>::type;
+            static_assert(std::is_arithmetic<Stored>::value, "Schema fields should be arithmetic or enumeration types.");
+            static_assert(!std::is_same<std::remove_cv_t<Stored>, bool>::value, "Schema fields should not be of the boolean type.");
+
+            Stored value{};
+            std::memcpy(&value, source, sizeof(Stored));
+            field = static_cast<T>(toEndianness<order>(value));
+        }
+    }
+
+    /// Compile time description of the binary layout of a message struct.
+    /// Fields are stored one after another, without padding, in the order of \p members and in the \p order byte order.
+    /// \example Schema<endianness_t::big, &Header::type, &Header::length> describes 6-byte header for
+    /// struct Header { uint16_t type; uint32_t length; }.
+    /// \remark Offsets of all fields are compile time constants, so the compiler merges stores (loads) of adjacent fields
+    /// into wider ones; no dry run is needed to size the buffer - see encodedSize.
+    /// \tparam order Byte order of the fields.
+    /// \tparam members Pointers to the data members of the same class; arithmetic and enumeration types are supported.
+    template <endianness_t order, auto... members>
+    class Schema
+    {
+        static_assert(sizeof...(members) > 0, "Schema should describe at least one field.");
+        static_assert(order != endianness_t::unknown, "'order' should be either big or little.");
+
+        using FirstMember = std::tuple_element_t<0, std::tuple<decltype(members)...>>;
+
+    public:
+        /// Type of the described message.
+        using message_type = typename detail::member_pointer_traits<FirstMember>::class_type;
+
+        static_assert((std::is_same<message_type, typename detail::member_pointer_traits<decltype(members)>::class_type>::value && ...),
+                      "All members should belong to the same class.");
+        static_assert((!std::is_same<std::remove_cv_t<typename detail::member_pointer_traits<decltype(members)>::member_type>,
+                                     bool>::value && ...),
+                      "Schema fields should not be of the boolean type; store it as uint8_t.");
+
+        /// Number of fields of the message.
+        static constexpr size_t fieldsCount = sizeof...(members);
+
+        /// Sizes of the fields in bytes.
+        static constexpr std::array<size_t, fieldsCount> fieldSizes{
+                sizeof(typename detail::member_pointer_traits<decltype(members)>::member_type)...};
+
+        /// Offsets of the fields in the encoded message.
+        static constexpr std::array<size_t, fieldsCount> fieldOffsets = []
+        {
+            std::array<size_t, fieldsCount> offsets{};
+            for (size_t i = 1; i < fieldsCount; ++i)
+            {
+                offsets[i] = offsets[i - 1] + fieldSizes[i - 1];
+            }
+            return offsets;
+        }();
+
+        /// Size of the encoded message in bytes.
+        static constexpr size_t encodedSize = fieldOffsets[fieldsCount - 1] + fieldSizes[fieldsCount - 1];
+
+        /// Serialize \p message into the \p destination buffer.
+        /// \param message Message to be serialized.
+        /// \param destination Output buffer, should have room for encodedSize bytes.
+        /// \return Number of bytes written - encodedSize.
+        static size_t serialize(const message_type &message, uint8_t *destination) noexcept
+        {
+            serializeFields(message, destination, std::make_index_sequence<fieldsCount>{});
+            return encodedSize;
+        }
+
+        /// Deserialize \p message from the \p source buffer.
+        /// \param source Encoded message, encodedSize bytes.
+        /// \param message Output for the deserialized message.
+        /// \return Number of bytes read - encodedSize.
+        static size_t deserialize(const uint8_t *source, message_type &message) noexcept
+        {
+            deserializeFields(source, message, std::make_index_sequence<fieldsCount>{});
+            return encodedSize;
+        }
+
+    private:
+        template <size_t... indices>
+        static void serializeFields(const message_type &message, uint8_t *destination, std::index_sequence<indices...>) noexcept
+        {
+            (detail::storeSchemaField<order>(message.*members, destination + fieldOffsets[indices]), ...);
+        }
+
+        template <size_t... indices>
+        static void deserializeFields(const uint8_t *source, message_type &message, std::index_sequence<indices...>) noexcept
+        {
+            (detail::loadSchemaField<order>(message.*members, source + fieldOffsets[indices]), ...);
+        }
+    };
+}
@@ -0,0 +1,248 @@
+/*
+    This file is distributed under MIT License.
+
+    Copyright (c) 2019 draghan
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace toolbox::memory
+{
+    namespace detail
+    {
+        /// Count trailing zero bits of the non-zero \p value.
+        inline size_t countTrailingZeros(uint64_t value) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(value));
+#else
+            size_t zeros{0};
+            while ((value & 1u) == 0)
+            {
+                value >>= 1u;
+                ++zeros;
+            }
+            return zeros;
+#endif
+        }
+
+        /// Load eight bytes as a little endian word, regardless of the CPU byte order.
+        inline uint64_t loadLittleEndianWord(const uint8_t *data) noexcept
+        {
+            uint64_t word{0};
+            for (size_t i = 0; i < 8; ++i)
+            {
+                word |= static_cast<uint64_t>(data[i]) << (8 * i);
+            }
+            return word;
+        }
+
+        /// Join (SWAR) 7-bit groups of up to 8 varint bytes loaded by loadLittleEndianWord into a single value.
+        /// \remark Equivalent of the BMI2 pext instruction with 0x7F7F7F7F7F7F7F7F mask, without requiring BMI2.
+        constexpr uint64_t compactVarintGroups(uint64_t word) noexcept
+        {
+            word &= 0x7F7F7F7F7F7F7F7Fu;
+            word = ((word & 0x7F007F007F007F00u) >> 1u) | (word & 0x007F007F007F007Fu);
+            word = ((word & 0x3FFF00003FFF0000u) >> 2u) | (word & 0x00003FFF00003FFFu);
+            word = ((word & 0x0FFFFFFF00000000u) >> 4u) | (word & 0x000000000FFFFFFFu);
+            return word;
+        }
+
+        /// Mask of the lowest \p bytesCount bytes of a word.
+        constexpr uint64_t lowBytesMask(size_t bytesCount) noexcept
+        {
+            return bytesCount >= 8 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << (8 * bytesCount)) - 1;
+        }
+    }
+
+    /// Maximal number of bytes of the varint encoding of type \p T.
+    template <typename T>
+    inline constexpr size_t maxVarintLength = (std::numeric_limits<T>::digits + 6) / 7;
+
+    /// Map signed value to unsigned one so the values of small magnitude have small encoding (0, -1, 1, -2 -> 0, 1, 2, 3).
+    /// \tparam T Signed integral type.
+    /// \param value Value to be encoded.
+    /// \return Zigzag encoded value.
+    template <typename T>
+    constexpr std::make_unsigned_t<T> zigzagEncode(T value) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "'T' should be signed integral type.");
+        using Unsigned = std::make_unsigned_t<T>;
+        const auto sign = static_cast<Unsigned>(value < 0 ? std::numeric_limits<Unsigned>::max() : 0);
+        return static_cast<Unsigned>((static_cast<Unsigned>(value) << 1u) ^ sign);
+    }
+
+    /// Inverse of zigzagEncode.
+    /// \tparam T Unsigned integral type.
+    /// \param value Zigzag encoded value.
+    /// \return Decoded signed value.
+    template <typename T>
+    constexpr std::make_signed_t<T> zigzagDecode(T value) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "'T' should be unsigned integral type.");
+        const auto sign = static_cast<T>((value & 1u) != 0 ? std::numeric_limits<T>::max() : 0);
+        return static_cast<std::make_signed_t<T>>((value >> 1u) ^ sign);
+    }
+
+    /// Encode value as varint (unsigned LEB128): 7 bits per byte, the least significant first, high bit set on all bytes but the last.
+    /// \tparam T Unsigned integral type; use zigzagEncode for signed values.
+    /// \param value Value to be encoded.
+    /// \param destination Output buffer, should have room for at least maxVarintLength<T> bytes.
+    /// \return Number of bytes written.
+    template <typename T>
+    size_t encodeVarint(T value, uint8_t *destination) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "'T' should be unsigned integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        size_t written{0};
+        while (value >= 0x80u)
+        {
+            destination[written++] = static_cast<uint8_t>(value | 0x80u);
+            value = static_cast<T>(value >> 7u);
+        }
+        destination[written++] = static_cast<uint8_t>(value);
+        return written;
+    }
+
+    /// Decode single varint (unsigned LEB128).
+    /// \tparam T Unsigned integral type.
+    /// \param data Encoded data.
+    /// \param size Size of the \p data in bytes.
+    /// \param value Output for the decoded value; left untouched if the decoding fails.
+    /// \return Number of consumed bytes, or 0 if the varint is truncated, too long or doesn't fit into \p T.
+    /// \remark Varints up to 8 bytes long are decoded with a single word load when at least 8 bytes are available.
+    template <typename T>
+    size_t decodeVarint(const uint8_t *data, size_t size, T &value) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "'T' should be unsigned integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        if (size >= 8)
+        {
+            const uint64_t word = detail::loadLittleEndianWord(data);
+            const uint64_t terminators = ~word & 0x8080808080808080u;
+            if (terminators != 0)
+            {
+                const size_t length = detail::countTrailingZeros(terminators) / 8 + 1;
+                const uint64_t decoded = detail::compactVarintGroups(word & detail::lowBytesMask(length));
+                if (length > maxVarintLength<T> || decoded > std::numeric_limits<T>::max())
+                {
+                    return 0;
+                }
+                value = static_cast<T>(decoded);
+                return length;
+            }
+        }
+
+        uint64_t decoded{0};
+        const size_t maxLength = std::min(size, maxVarintLength<T>);
+        for (size_t i = 0; i < maxLength; ++i)
+        {
+            const uint64_t group = data[i] & 0x7Fu;
+            const size_t shift = 7 * i;
+            if (shift + 7 > 64 && (group >> (64 - shift)) != 0)
+            {
+                return 0;
+            }
+            decoded |= group << shift;
+            if ((data[i] & 0x80u) == 0)
+            {
+                if (decoded > std::numeric_limits<T>::max())
+                {
+                    return 0;
+                }
+                value = static_cast<T>(decoded);
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    /// Decode \p count consecutive varints (unsigned LEB128) into \p destination.
+    /// \tparam T Unsigned integral type.
+    /// \param data Encoded data.
+    /// \param size Size of the \p data in bytes.
+    /// \param destination Output buffer, should have room for \p count values.
+    /// \param count Number of varints to be decoded.
+    /// \param consumed Number of bytes consumed by the successfully decoded varints.
+    /// \return True if all \p count varints were decoded, false if the data is malformed or truncated.
+    /// \remark All varints terminated within a single 8-byte word are decoded from one load, so runs of short varints
+    /// cost a few arithmetic operations per value.
+    template <typename T>
+    bool decodeVarints(const uint8_t *data, size_t size, T *destination, size_t count, size_t &consumed) noexcept
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "'T' should be unsigned integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        consumed = 0;
+        size_t decodedCount{0};
+        while (decodedCount < count && size - consumed >= 8)
+        {
+            const uint64_t word = detail::loadLittleEndianWord(data + consumed);
+            uint64_t terminators = ~word & 0x8080808080808080u;
+            if (terminators == 0)
+            {
+                // varint longer than 8 bytes:
+                const size_t length = decodeVarint(data + consumed, size - consumed, destination[decodedCount]);
+                if (length == 0)
+                {
+                    return false;
+                }
+                consumed += length;
+                ++decodedCount;
+                continue;
+            }
+
+            size_t start{0};
+            while (terminators != 0 && decodedCount < count)
+            {
+                const size_t end = detail::countTrailingZeros(terminators) / 8 + 1;
+                const uint64_t decoded = detail::compactVarintGroups((word >> (8 * start)) & detail::lowBytesMask(end - start));
+                if (end - start > maxVarintLength<T> || decoded > std::numeric_limits<T>::max())
+                {
+                    return false;
+                }
+                destination[decodedCount++] = static_cast<T>(decoded);
+                terminators &= terminators - 1;
+                start = end;
+            }
+            consumed += start;
+        }
+
+        for (; decodedCount < count; ++decodedCount)
+        {
+            const size_t length = decodeVarint(data + consumed, size - consumed, destination[decodedCount]);
+            if (length == 0)
+            {
+                return false;
+            }
+            consumed += length;
+        }
+        return true;
+    }
+}
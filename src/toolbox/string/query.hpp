@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <string>
 #include <string_view>
 #include "../containers/query.hpp"
 
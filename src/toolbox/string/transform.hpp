@@ -27,10 +27,707 @@
 #include "../memory/chopping.hpp"
 #include "./query.hpp"
 
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace toolbox::string
 {
+    namespace detail
+    {
+        /// Lookup table translating ASCII character to the value of a hex digit; 0xFF marks characters which aren't hex digits.
+        inline constexpr std::array<uint8_t, 256> hexDigitValues = []
+        {
+            std::array<uint8_t, 256> values{};
+            for (auto &value : values)
+            {
+                value = 0xFF;
+            }
+            for (uint8_t digit = 0; digit < 10; ++digit)
+            {
+                values[static_cast<uint8_t>('0' + digit)] = digit;
+            }
+            for (uint8_t digit = 0; digit < 6; ++digit)
+            {
+                values[static_cast<uint8_t>('a' + digit)] = static_cast<uint8_t>(10 + digit);
+                values[static_cast<uint8_t>('A' + digit)] = static_cast<uint8_t>(10 + digit);
+            }
+            return values;
+        }();
+
+        /// Lookup table with all two-digit decimal numbers "00".."99" written one after another.
+        inline constexpr std::array<char, 200> decimalDigitPairs = []
+        {
+            std::array<char, 200> pairs{};
+            for (size_t number = 0; number < 100; ++number)
+            {
+                pairs[2 * number] = static_cast<char>('0' + number / 10);
+                pairs[2 * number + 1] = static_cast<char>('0' + number % 10);
+            }
+            return pairs;
+        }();
+
+        /// Load eight characters as a little endian word, regardless of the CPU byte order.
+        inline uint64_t loadEightChars(const char *characters) noexcept
+        {
+            uint64_t chunk{0};
+            for (size_t i = 0; i < 8; ++i)
+            {
+                chunk |= static_cast<uint64_t>(static_cast<uint8_t>(characters[i])) << (8 * i);
+            }
+            return chunk;
+        }
+
+        /// Test (SWAR) whether all eight characters loaded by loadEightChars are decimal digits.
+        constexpr bool isEightDigits(uint64_t chunk) noexcept
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0u) | (((chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4u)) == 0x3333333333333333u;
+        }
+
+        /// Compute (SWAR) value of eight decimal digits loaded by loadEightChars; the first character is the most significant digit.
+        constexpr uint32_t parseEightDigits(uint64_t chunk) noexcept
+        {
+            constexpr uint64_t mask = 0x000000FF000000FFu;
+            constexpr uint64_t multiplier1 = 100u + (1000000ull << 32u);
+            constexpr uint64_t multiplier2 = 1u + (10000ull << 32u);
+            chunk -= 0x3030303030303030u;
+            chunk = (chunk * 10u) + (chunk >> 8u);
+            return static_cast<uint32_t>((((chunk & mask) * multiplier1) + (((chunk >> 16u) & mask) * multiplier2)) >> 32u);
+        }
+
+        /// Base64 alphabets: standard one (RFC 4648 section 4) followed by the URL and filename safe one (section 5).
+        inline constexpr std::array<std::array<char, 64>, 2> base64Alphabets = []
+        {
+            constexpr std::string_view standard{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+            std::array<std::array<char, 64>, 2> alphabets{};
+            for (size_t i = 0; i < standard.size(); ++i)
+            {
+                alphabets[0][i] = standard[i];
+                alphabets[1][i] = standard[i];
+            }
+            alphabets[1][62] = '-';
+            alphabets[1][63] = '_';
+            return alphabets;
+        }();
+
+        /// Lookup tables translating ASCII character to the 6-bit Base64 value, one per alphabet; 0xFF marks invalid characters.
+        inline constexpr std::array<std::array<uint8_t, 256>, 2> base64Values = []
+        {
+            std::array<std::array<uint8_t, 256>, 2> values{};
+            for (size_t alphabet = 0; alphabet < values.size(); ++alphabet)
+            {
+                for (auto &value : values[alphabet])
+                {
+                    value = 0xFF;
+                }
+                for (size_t i = 0; i < base64Alphabets[alphabet].size(); ++i)
+                {
+                    values[alphabet][static_cast<uint8_t>(base64Alphabets[alphabet][i])] = static_cast<uint8_t>(i);
+                }
+            }
+            return values;
+        }();
+
+        /// Encode whole 3-byte groups of \p source into 4-character groups of the \p destination.
+        inline void encodeBase64GroupsScalar(const uint8_t *source, size_t groupsCount, char *destination, const std::array<char, 64> &alphabet) noexcept
+        {
+            for (size_t group = 0; group < groupsCount; ++group, source += 3, destination += 4)
+            {
+                const uint32_t bits = static_cast<uint32_t>(source[0] << 16u) | static_cast<uint32_t>(source[1] << 8u) | source[2];
+                destination[0] = alphabet[(bits >> 18u) & 0x3Fu];
+                destination[1] = alphabet[(bits >> 12u) & 0x3Fu];
+                destination[2] = alphabet[(bits >> 6u) & 0x3Fu];
+                destination[3] = alphabet[bits & 0x3Fu];
+            }
+        }
+
+        /// Encode the last 1 or 2 bytes of input; the missing characters are replaced with '=' if \p padding is requested.
+        inline size_t encodeBase64Tail(const uint8_t *source, size_t size, char *destination, const std::array<char, 64> &alphabet, bool padding) noexcept
+        {
+            if (size == 0)
+            {
+                return 0;
+            }
+
+            const uint32_t bits = static_cast<uint32_t>(source[0] << 16u) | (size > 1 ? static_cast<uint32_t>(source[1] << 8u) : 0u);
+            size_t written{0};
+            destination[written++] = alphabet[(bits >> 18u) & 0x3Fu];
+            destination[written++] = alphabet[(bits >> 12u) & 0x3Fu];
+            if (size > 1)
+            {
+                destination[written++] = alphabet[(bits >> 6u) & 0x3Fu];
+            }
+            if (padding)
+            {
+                while (written < 4)
+                {
+                    destination[written++] = '=';
+                }
+            }
+            return written;
+        }
+
+        /// Decode 4-character groups of \p source into 3-byte groups of the \p destination.
+        /// \return Number of decoded groups; decoding stops at the first group containing character outside the alphabet.
+        inline size_t decodeBase64GroupsScalar(const char *source, size_t groupsCount, uint8_t *destination, const std::array<uint8_t, 256> &values) noexcept
+        {
+            for (size_t group = 0; group < groupsCount; ++group, source += 4, destination += 3)
+            {
+                const uint8_t value0 = values[static_cast<uint8_t>(source[0])];
+                const uint8_t value1 = values[static_cast<uint8_t>(source[1])];
+                const uint8_t value2 = values[static_cast<uint8_t>(source[2])];
+                const uint8_t value3 = values[static_cast<uint8_t>(source[3])];
+                if (((value0 | value1 | value2 | value3) & 0x80u) != 0)
+                {
+                    return group;
+                }
+
+                const uint32_t bits = static_cast<uint32_t>(value0 << 18u) | static_cast<uint32_t>(value1 << 12u) | static_cast<uint32_t>(value2 << 6u) | value3;
+                destination[0] = static_cast<uint8_t>(bits >> 16u);
+                destination[1] = static_cast<uint8_t>(bits >> 8u);
+                destination[2] = static_cast<uint8_t>(bits);
+            }
+            return groupsCount;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Offsets added to the 6-bit values by base64Characters, indexed by the class of the value: 0 for 26 - 51,
+        /// 1 - 10 for digits, 11 and 12 for 62 and 63, 13 for 0 - 25.
+        /// \remark Letters and digits are shared by both alphabets, only the characters of values 62 and 63 differ.
+        __attribute__((target("avx2")))
+        inline __m256i base64CharacterOffsets(const std::array<char, 64> &alphabet) noexcept
+        {
+            const auto offset = [&alphabet](int value)
+            {
+                return static_cast<char>(alphabet[static_cast<size_t>(value)] - value);
+            };
+            return _mm256_setr_epi8(offset(26), offset(52), offset(52), offset(52), offset(52), offset(52), offset(52), offset(52),
+                                    offset(52), offset(52), offset(52), offset(62), offset(63), offset(0), 0, 0,
+                                    offset(26), offset(52), offset(52), offset(52), offset(52), offset(52), offset(52), offset(52),
+                                    offset(52), offset(52), offset(52), offset(62), offset(63), offset(0), 0, 0);
+        }
+
+        /// Translate 6-bit \p values to the characters of the alphabet given by base64CharacterOffsets.
+        __attribute__((target("avx2")))
+        inline __m256i base64Characters(__m256i values, __m256i offsets) noexcept
+        {
+            __m256i classes = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+            const __m256i upperCase = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+            classes = _mm256_or_si256(classes, _mm256_and_si256(upperCase, _mm256_set1_epi8(13)));
+            return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, classes));
+        }
+
+        /// AVX2 version of encodeBase64GroupsScalar, encoding 24 bytes into 32 characters per iteration.
+        /// \return Number of encoded groups, a multiple of 8; the rest is left for the scalar code.
+        /// \remark Each 128-bit lane loads 16 bytes and uses 12 of them, so the last 4 bytes of input are never loaded as a part
+        /// of the vector - there are always at least 28 bytes available.
+        __attribute__((target("avx2")))
+        inline size_t encodeBase64GroupsAvx2(const uint8_t *source, size_t groupsCount, char *destination, const std::array<char, 64> &alphabet) noexcept
+        {
+            // spread each 3-byte group to a 32-bit lane as bytes 1, 0, 2, 1, so all four 6-bit values lie in 16-bit halves:
+            const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+            const __m256i offsets = base64CharacterOffsets(alphabet);
+
+            size_t group{0};
+            for (; (groupsCount - group) * 3 >= 28; group += 8, source += 24, destination += 32)
+            {
+                const __m256i bytes = _mm256_shuffle_epi8(_mm256_loadu2_m128i(reinterpret_cast<const __m128i *>(source + 12),
+                                                                              reinterpret_cast<const __m128i *>(source)), spread);
+
+                // move the 6-bit values to the low bits of consecutive bytes with one multiplication per pair of them:
+                const __m256i first = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+                const __m256i second = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+                const __m256i characters = base64Characters(_mm256_or_si256(first, second), offsets);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), characters);
+            }
+            return group;
+        }
+
+        /// AVX2 version of decodeBase64GroupsScalar, decoding 32 characters into 24 bytes per iteration.
+        /// \return Number of decoded groups, a multiple of 8; it stops before the first vector containing character outside
+        /// the \p alphabet, which is left for the scalar code together with the rest of input.
+        /// \remark Characters are translated by their high nibble (and compared with two last characters of the alphabet),
+        /// then the values are validated by translating them back with base64Characters.
+        __attribute__((target("avx2")))
+        inline size_t decodeBase64GroupsAvx2(const char *source, size_t groupsCount, uint8_t *destination, const std::array<char, 64> &alphabet) noexcept
+        {
+            const auto offset = [&alphabet](int value)
+            {
+                return static_cast<char>(value - alphabet[static_cast<size_t>(value)]);
+            };
+            const __m256i offsetsByHighNibble = _mm256_setr_epi8(0, 0, 0, offset(52), offset(0), offset(0), offset(26), offset(26), 0, 0, 0, 0, 0, 0, 0, 0,
+                                                                 0, 0, 0, offset(52), offset(0), offset(0), offset(26), offset(26), 0, 0, 0, 0, 0, 0, 0, 0);
+            const __m256i character62 = _mm256_set1_epi8(alphabet[62]);
+            const __m256i character63 = _mm256_set1_epi8(alphabet[63]);
+            const __m256i characterOffsets = base64CharacterOffsets(alphabet);
+            // gather 24 used bytes of both lanes in the first 6 32-bit elements:
+            const __m256i gather = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+            const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+            size_t group{0};
+            for (; group + 8 <= groupsCount; group += 8, source += 32, destination += 24)
+            {
+                const __m256i characters = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+                const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(characters, 4), _mm256_set1_epi8(0x0F));
+                __m256i offsets = _mm256_shuffle_epi8(offsetsByHighNibble, highNibbles);
+                offsets = _mm256_blendv_epi8(offsets, _mm256_set1_epi8(offset(62)), _mm256_cmpeq_epi8(characters, character62));
+                offsets = _mm256_blendv_epi8(offsets, _mm256_set1_epi8(offset(63)), _mm256_cmpeq_epi8(characters, character63));
+                const __m256i values = _mm256_add_epi8(characters, offsets);
+
+                const __m256i inRange = _mm256_cmpeq_epi8(_mm256_min_epu8(values, _mm256_set1_epi8(63)), values);
+                const __m256i translatedBack = _mm256_cmpeq_epi8(base64Characters(values, characterOffsets), characters);
+                if (_mm256_movemask_epi8(_mm256_and_si256(inRange, translatedBack)) != -1)
+                {
+                    break;
+                }
+
+                // join pairs of 6-bit values into 12-bit ones, then pairs of those into 24-bit groups in 32-bit lanes:
+                const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+                const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+                const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(groups, gather), compact);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm256_castsi256_si128(bytes));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(destination + 16), _mm256_extracti128_si256(bytes, 1));
+            }
+            return group;
+        }
+#endif
+
+        /// Encode whole 3-byte groups of \p source into 4-character groups of the \p destination.
+        /// \remark Uses AVX2 when the CPU supports it (detected at runtime) for long inputs; scalar loop otherwise.
+        inline void encodeBase64Groups(const uint8_t *source, size_t groupsCount, char *destination, const std::array<char, 64> &alphabet) noexcept
+        {
+            size_t encoded{0};
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (groupsCount >= 10 && container::detail::hasAvx2())
+            {
+                encoded = encodeBase64GroupsAvx2(source, groupsCount, destination, alphabet);
+            }
+#endif
+            encodeBase64GroupsScalar(source + encoded * 3, groupsCount - encoded, destination + encoded * 4, alphabet);
+        }
+
+        /// Decode 4-character groups of \p source into 3-byte groups of the \p destination.
+        /// \return Number of decoded groups; decoding stops at the first group containing character outside the alphabet.
+        /// \remark Uses AVX2 when the CPU supports it (detected at runtime) for long inputs; scalar loop otherwise.
+        inline size_t decodeBase64Groups(const char *source, size_t groupsCount, uint8_t *destination,
+                                         const std::array<char, 64> &alphabet, const std::array<uint8_t, 256> &values) noexcept
+        {
+            size_t decoded{0};
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (groupsCount >= 8 && container::detail::hasAvx2())
+            {
+                decoded = decodeBase64GroupsAvx2(source, groupsCount, destination, alphabet);
+            }
+#endif
+            return decoded + decodeBase64GroupsScalar(source + decoded * 4, groupsCount - decoded, destination + decoded * 3, values);
+        }
+
+        /// Decode the last 2 or 3 characters of input (without padding); unused trailing bits have to be zero.
+        inline bool decodeBase64Tail(const char *source, size_t size, uint8_t *destination, size_t &written, const std::array<uint8_t, 256> &values) noexcept
+        {
+            written = 0;
+            if (size == 0)
+            {
+                return true;
+            }
+            if (size == 1 || size > 3)
+            {
+                return false;
+            }
+
+            const uint8_t value0 = values[static_cast<uint8_t>(source[0])];
+            const uint8_t value1 = values[static_cast<uint8_t>(source[1])];
+            const uint8_t value2 = size > 2 ? values[static_cast<uint8_t>(source[2])] : uint8_t{0};
+            if (((value0 | value1 | value2) & 0x80u) != 0)
+            {
+                return false;
+            }
+
+            const uint32_t bits = static_cast<uint32_t>(value0 << 18u) | static_cast<uint32_t>(value1 << 12u) | static_cast<uint32_t>(value2 << 6u);
+            const uint32_t unusedBits = size == 2 ? 0xFFFFu : 0xFFu;
+            if ((bits & unusedBits) != 0)
+            {
+                return false;
+            }
+
+            destination[written++] = static_cast<uint8_t>(bits >> 16u);
+            if (size > 2)
+            {
+                destination[written++] = static_cast<uint8_t>(bits >> 8u);
+            }
+            return true;
+        }
+
+        /// Count padding characters at the end of the last 4-character group of padded Base64 input.
+        constexpr size_t countBase64Padding(std::string_view group) noexcept
+        {
+            if (endsWith(group, "=="))
+            {
+                return 2;
+            }
+            return endsWith(group, '=') ? 1 : 0;
+        }
+
+        /// Lookup table with two-character hex representation of every byte value, lowercase ones followed by uppercase ones.
+        inline constexpr std::array<char, 1024> hexDigitPairs = []
+        {
+            constexpr std::string_view lowercase{"0123456789abcdef"};
+            constexpr std::string_view uppercase{"0123456789ABCDEF"};
+            std::array<char, 1024> pairs{};
+            for (size_t byte = 0; byte < 256; ++byte)
+            {
+                pairs[2 * byte] = lowercase[byte >> 4u];
+                pairs[2 * byte + 1] = lowercase[byte & 0x0Fu];
+                pairs[512 + 2 * byte] = uppercase[byte >> 4u];
+                pairs[512 + 2 * byte + 1] = uppercase[byte & 0x0Fu];
+            }
+            return pairs;
+        }();
+
+        /// Hex digits, lowercase ones followed by uppercase ones.
+        inline constexpr std::string_view hexDigits{"0123456789abcdef0123456789ABCDEF"};
+
+        /// Lookup table translating byte to the character shown in the text column of hexdump - printable ASCII or '.'.
+        inline constexpr std::array<char, 256> hexDumpCharacters = []
+        {
+            std::array<char, 256> characters{};
+            for (size_t byte = 0; byte < characters.size(); ++byte)
+            {
+                characters[byte] = (byte >= 0x20 && byte < 0x7F) ? static_cast<char>(byte) : '.';
+            }
+            return characters;
+        }();
+
+        /// Encode \p size bytes of \p source as hex digits, taken as pairs from the lowercase or uppercase part of hexDigitPairs.
+        inline void encodeHexScalar(const uint8_t *source, size_t size, char *destination, bool uppercase) noexcept
+        {
+            const char *pairs = hexDigitPairs.data() + (uppercase ? 512 : 0);
+            for (size_t i = 0; i < size; ++i)
+            {
+                destination[2 * i] = pairs[2u * source[i]];
+                destination[2 * i + 1] = pairs[2u * source[i] + 1];
+            }
+        }
+
+        /// Write the hex and text columns of a hexdump line with up to 16 bytes of \p data, following the offset.
+        /// \return Pointer past the last written character.
+        inline char *writeHexDumpColumnsScalar(const uint8_t *data, size_t size, char *current) noexcept
+        {
+            for (size_t column = 0; column < 16; ++column)
+            {
+                if (column % 8 == 0)
+                {
+                    *current++ = ' ';
+                }
+                if (column < size)
+                {
+                    *current++ = hexDigitPairs[2u * data[column]];
+                    *current++ = hexDigitPairs[2u * data[column] + 1];
+                }
+                else
+                {
+                    *current++ = ' ';
+                    *current++ = ' ';
+                }
+                *current++ = ' ';
+            }
+
+            *current++ = ' ';
+            *current++ = '|';
+            for (size_t column = 0; column < size; ++column)
+            {
+                *current++ = hexDumpCharacters[data[column]];
+            }
+            *current++ = '|';
+            *current++ = '\n';
+            return current;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Translate both nibbles of each byte in \p bytes to hex digits taken from \p digits, the high ones to \p high
+        /// and the low ones to \p low.
+        __attribute__((target("avx2")))
+        inline void hexDigitsOf(__m256i bytes, __m256i digits, __m256i &high, __m256i &low) noexcept
+        {
+            const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+            high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowNibbles));
+            low = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, lowNibbles));
+        }
+
+        __attribute__((target("avx2")))
+        inline void hexDigitsOf(__m128i bytes, __m128i digits, __m128i &high, __m128i &low) noexcept
+        {
+            const __m128i lowNibbles = _mm_set1_epi8(0x0F);
+            high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibbles));
+            low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowNibbles));
+        }
+
+        /// AVX2 version of encodeHexScalar, encoding 32 bytes per iteration.
+        /// \return Number of encoded bytes, a multiple of 32; the rest is left for the scalar code.
+        __attribute__((target("avx2")))
+        inline size_t encodeHexAvx2(const uint8_t *source, size_t size, char *destination, bool uppercase) noexcept
+        {
+            const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                    hexDigits.data() + (uppercase ? 16 : 0))));
+
+            size_t i{0};
+            for (; i + 32 <= size; i += 32)
+            {
+                __m256i high;
+                __m256i low;
+                hexDigitsOf(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i)), digits, high, low);
+                // interleaving works within 128-bit lanes, the first result holds digits of bytes 0 - 7 and 16 - 23:
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return i;
+        }
+
+        /// Write 25 characters of a hexdump group of 8 columns: a space, then pairs of hex \p digits followed by a space each.
+        /// \remark Writes 32 characters; the excess has to be overwritten by the following part of the line.
+        __attribute__((target("avx2")))
+        inline void writeHexDumpGroupAvx2(__m128i digits, char *destination) noexcept
+        {
+            // empty shuffle lanes are filled with spaces:
+            const __m128i head = _mm_setr_epi8(-1, 0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1);
+            const __m128i tail = _mm_setr_epi8(10, 11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m128i headSpaces = _mm_setr_epi8(' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ');
+            const __m128i tailSpaces = _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, 0, 0, 0, 0, 0);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_or_si128(_mm_shuffle_epi8(digits, head), headSpaces));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 16), _mm_or_si128(_mm_shuffle_epi8(digits, tail), tailSpaces));
+        }
+
+        /// AVX2 version of writeHexDumpColumnsScalar for a full line of 16 bytes.
+        /// \remark The columns are written with overlapping 16-byte stores, each one overwriting the excess of the previous one;
+        /// nothing is written past the end of the line.
+        __attribute__((target("avx2")))
+        inline char *writeHexDumpColumnsAvx2(const uint8_t *data, char *current) noexcept
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            __m128i high;
+            __m128i low;
+            hexDigitsOf(bytes, _mm_loadu_si128(reinterpret_cast<const __m128i *>(hexDigits.data())), high, low);
+            writeHexDumpGroupAvx2(_mm_unpacklo_epi8(high, low), current);
+            writeHexDumpGroupAvx2(_mm_unpackhi_epi8(high, low), current + 25);
+            current += 50;
+
+            // printable ASCII is kept, other bytes (including negative ones) are replaced with dots:
+            const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F)), _mm_cmpgt_epi8(_mm_set1_epi8(0x7F), bytes));
+            *current++ = ' ';
+            *current++ = '|';
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(current), _mm_blendv_epi8(_mm_set1_epi8('.'), bytes, printable));
+            current += 16;
+            *current++ = '|';
+            *current++ = '\n';
+            return current;
+        }
+#endif
+
+        /// Write a single hexdump line: offset, up to 16 bytes in hex and their text representation.
+        /// \return Number of characters written.
+        /// \remark Full lines are formatted with AVX2 when the CPU supports it (detected at runtime).
+        inline size_t writeHexDumpLine(uint64_t offset, size_t offsetDigits, const uint8_t *data, size_t size, char *destination) noexcept
+        {
+            char *current = destination;
+            for (size_t digit = offsetDigits; digit > 0; digit -= 2)
+            {
+                const auto byte = static_cast<uint8_t>(offset >> (4 * (digit - 2)));
+                *current++ = hexDigitPairs[2u * byte];
+                *current++ = hexDigitPairs[2u * byte + 1];
+            }
+            *current++ = ' ';
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+            if (size == 16 && container::detail::hasAvx2())
+            {
+                return static_cast<size_t>(writeHexDumpColumnsAvx2(data, current) - destination);
+            }
+#endif
+            return static_cast<size_t>(writeHexDumpColumnsScalar(data, size, current) - destination);
+        }
+
+        /// Decode 32 hex digits of UUID \p text (with dashes of the canonical form if \p dashed) into \p uuid.
+        /// \return False if any of the digits isn't a hex digit; \p uuid is left untouched then.
+        inline bool decodeUuidScalar(std::string_view text, bool dashed, std::array<uint8_t, 16> &uuid) noexcept
+        {
+            // gather hex digits only, so they could be decoded in a single pass:
+            std::array<char, 32> digits{};
+            if (dashed)
+            {
+                const auto copyDigits = [&text, &digits](size_t from, size_t count, size_t to)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        digits[to + i] = text[from + i];
+                    }
+                };
+                copyDigits(0, 8, 0);
+                copyDigits(9, 4, 8);
+                copyDigits(14, 4, 12);
+                copyDigits(19, 4, 16);
+                copyDigits(24, 12, 20);
+            }
+            else
+            {
+                std::copy(text.cbegin(), text.cend(), digits.begin());
+            }
+
+            std::array<uint8_t, 16> bytes{};
+            uint8_t invalidBits{0};
+            for (size_t i = 0; i < bytes.size(); ++i)
+            {
+                const uint8_t high = hexDigitValues[static_cast<uint8_t>(digits[2 * i])];
+                const uint8_t low = hexDigitValues[static_cast<uint8_t>(digits[2 * i + 1])];
+                invalidBits = static_cast<uint8_t>(invalidBits | high | low);
+                bytes[i] = static_cast<uint8_t>((high << 4u) | (low & 0x0Fu));
+            }
+
+            if ((invalidBits & 0xF0u) != 0)
+            {
+                return false;
+            }
+            uuid = bytes;
+            return true;
+        }
+
+        /// Write 16 bytes of \p uuid as 32 lowercase hex digits, with dashes of the canonical form if \p dashed.
+        /// \return Number of characters written to the \p destination.
+        inline size_t encodeUuidScalar(const std::array<uint8_t, 16> &uuid, bool dashed, char *destination) noexcept
+        {
+            if (!dashed)
+            {
+                encodeHexScalar(uuid.data(), uuid.size(), destination, false);
+                return 32;
+            }
+
+            encodeHexScalar(uuid.data(), 4, destination, false);
+            destination[8] = '-';
+            encodeHexScalar(uuid.data() + 4, 2, destination + 9, false);
+            destination[13] = '-';
+            encodeHexScalar(uuid.data() + 6, 2, destination + 14, false);
+            destination[18] = '-';
+            encodeHexScalar(uuid.data() + 8, 2, destination + 19, false);
+            destination[23] = '-';
+            encodeHexScalar(uuid.data() + 10, 6, destination + 24, false);
+            return 36;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        /// Check whether the CPU provides SSSE3 instructions (byte shuffles).
+        inline bool hasSsse3() noexcept
+        {
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("ssse3") != 0;
+            }();
+            return supported;
+        }
+
+        /// Translate 16 hex \p digits (lower or uppercase) to their values; bytes of \p invalid are set to all ones
+        /// for characters which aren't hex digits.
+        __attribute__((target("ssse3")))
+        inline __m128i hexDigitValuesSsse3(__m128i digits, __m128i &invalid) noexcept
+        {
+            // both subtractions wrap around, so the digits are the only values not greater than 9 and 5 respectively:
+            const __m128i decimal = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+            const __m128i letter = _mm_sub_epi8(_mm_or_si128(digits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i isDecimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal);
+            const __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+            invalid = _mm_or_si128(invalid, _mm_xor_si128(_mm_or_si128(isDecimal, isLetter), _mm_set1_epi8(-1)));
+            return _mm_or_si128(_mm_and_si128(isDecimal, decimal), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+        }
+
+        /// SSSE3 version of decodeUuidScalar: dashes are dropped with shuffles, all 32 digits are decoded at once.
+        __attribute__((target("ssse3")))
+        inline bool decodeUuidSsse3(std::string_view text, bool dashed, std::array<uint8_t, 16> &uuid) noexcept
+        {
+            const auto *characters = reinterpret_cast<const __m128i *>(text.data());
+            __m128i first = _mm_loadu_si128(characters);
+            __m128i second = _mm_loadu_si128(characters + 1);
+            if (dashed)
+            {
+                // digits are at positions 0 - 7, 9 - 12, 14 - 17, 19 - 22 and 24 - 35 of the text:
+                const __m128i last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + 20));
+                first = _mm_or_si128(_mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -1, -1)),
+                                     _mm_shuffle_epi8(second, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1)));
+                second = _mm_or_si128(_mm_shuffle_epi8(second, _mm_setr_epi8(3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                      _mm_shuffle_epi8(last, _mm_setr_epi8(-1, -1, -1, -1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+            }
+
+            __m128i invalid = _mm_setzero_si128();
+            const __m128i firstValues = hexDigitValuesSsse3(first, invalid);
+            const __m128i secondValues = hexDigitValuesSsse3(second, invalid);
+            if (_mm_movemask_epi8(invalid) != 0)
+            {
+                return false;
+            }
+
+            // join pairs of digits into bytes:
+            const __m128i pairs = _mm_set1_epi16(0x0110);
+            const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(firstValues, pairs), _mm_maddubs_epi16(secondValues, pairs));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(uuid.data()), bytes);
+            return true;
+        }
+
+        /// SSSE3 version of encodeUuidScalar: all 32 digits are encoded at once, dashes are put in between with shuffles.
+        __attribute__((target("ssse3")))
+        inline size_t encodeUuidSsse3(const std::array<uint8_t, 16> &uuid, bool dashed, char *destination) noexcept
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(uuid.data()));
+            const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hexDigits.data()));
+            const __m128i lowNibbles = _mm_set1_epi8(0x0F);
+            const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibbles));
+            const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowNibbles));
+            const __m128i first = _mm_unpacklo_epi8(high, low);
+            const __m128i second = _mm_unpackhi_epi8(high, low);
+            auto *characters = reinterpret_cast<__m128i *>(destination);
+            if (!dashed)
+            {
+                _mm_storeu_si128(characters, first);
+                _mm_storeu_si128(characters + 1, second);
+                return 32;
+            }
+
+            // digits go to positions 0 - 7, 9 - 12, 14 - 17, 19 - 22 and 24 - 35, dashes are put in the zeroed shuffle lanes;
+            // the last store overwrites the last 12 characters of the middle one:
+            const __m128i head = _mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13));
+            const __m128i middle = _mm_or_si128(_mm_shuffle_epi8(first, _mm_setr_epi8(14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                                _mm_shuffle_epi8(second, _mm_setr_epi8(-1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+            const __m128i tail = _mm_shuffle_epi8(second, _mm_setr_epi8(1, 2, 3, -1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+            _mm_storeu_si128(characters, _mm_or_si128(head, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0)));
+            _mm_storeu_si128(characters + 1, _mm_or_si128(middle, _mm_setr_epi8(0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + 20), _mm_or_si128(tail, _mm_setr_epi8(0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)));
+            return 36;
+        }
+#endif
+
+        /// Count decimal digits needed to represent \p value.
+        constexpr size_t countDecimalDigits(uint64_t value) noexcept
+        {
+            size_t digits{1};
+            while (value >= 10000u)
+            {
+                value /= 10000u;
+                digits += 4;
+            }
+            if (value >= 1000u)
+            {
+                return digits + 3;
+            }
+            if (value >= 100u)
+            {
+                return digits + 2;
+            }
+            return value >= 10u ? digits + 1 : digits;
+        }
+    }
 
     /// Convert hex string to a numeric value.
     /// \tparam T Requested destination type for conversion.
@@ -66,4 +763,684 @@ namespace toolbox::string
         }
         return static_cast<T>(value);
     }
-}
\ No newline at end of file
+
+    /// Convert hex string to a numeric value without throwing and without any allocation.
+    /// \tparam T Requested destination type for conversion, should be unsigned integral type.
+    /// \param hexString Input hex string. Could contains 0x (or 0X) prefix and leading zeros.
+    /// \param value Output for the converted value; set to 0 if the conversion fails.
+    /// \return True if \p hexString is a valid hex value which fits into type \p T, false otherwise.
+    /// \remark Empty string (or sole prefix) is converted to 0, same as in convertHexString.
+    template <typename T>
+    constexpr bool tryConvertHexString(std::string_view hexString, T &value) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "'T' should be fundamental integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+        static_assert(std::is_unsigned<T>::value, "'T' should not store the sign bit.");
+
+        value = T{0};
+        if (startsWith(hexString, "0x") || startsWith(hexString, "0X"))
+        {
+            hexString.remove_prefix(2);
+        }
+
+        const size_t firstSignificant = hexString.find_first_not_of('0');
+        if (firstSignificant == std::string_view::npos)
+        {
+            return true;
+        }
+        hexString.remove_prefix(firstSignificant);
+
+        constexpr size_t maxDigits = std::numeric_limits<T>::digits / 4;
+        if (hexString.size() > maxDigits)
+        {
+            return false;
+        }
+
+        // accumulate all digits first and check validity once - invalid digits have the high nibble set:
+        T result{0};
+        uint8_t invalidBits{0};
+        for (const char character : hexString)
+        {
+            const uint8_t digit = detail::hexDigitValues[static_cast<uint8_t>(character)];
+            invalidBits = static_cast<uint8_t>(invalidBits | digit);
+            result = static_cast<T>((result << 4u) | (digit & 0x0Fu));
+        }
+
+        if ((invalidBits & 0xF0u) != 0)
+        {
+            return false;
+        }
+
+        value = result;
+        return true;
+    }
+
+    /// Convert a batch of hex fields into a column of numeric values.
+    /// \tparam T Requested destination type for conversion, should be unsigned integral type.
+    /// \tparam FieldsContainer Some container type with elements convertible to std::string_view.
+    /// \param fields Hex strings to be converted; the same format as in tryConvertHexString is accepted.
+    /// \param column Converted values are appended here, one per field (0 for invalid fields).
+    /// \param errors Error bitmap appended in parallel to \p column; true marks field which couldn't be converted.
+    /// \return Number of fields which couldn't be converted.
+    /// \remark Both \p column and \p errors are appended to, each after its own existing elements, even if their sizes differ.
+    template <typename T, class FieldsContainer>
+    size_t convertHexStrings(const FieldsContainer &fields, std::vector<T> &column, std::vector<bool> &errors)
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value,
+                      "'T' should be unsigned integral type.");
+
+        const size_t firstIndex = column.size();
+        const size_t firstErrorIndex = errors.size();
+        column.resize(firstIndex + fields.size());
+        errors.resize(firstErrorIndex + fields.size(), false);
+
+        size_t offset{0};
+        size_t errorsCount{0};
+        for (const auto &field : fields)
+        {
+            if (!tryConvertHexString<T>(std::string_view{field}, column[firstIndex + offset]))
+            {
+                errors[firstErrorIndex + offset] = true;
+                ++errorsCount;
+            }
+            ++offset;
+        }
+        return errorsCount;
+    }
+
+    /// Convert a delimiter-separated buffer of hex fields into a column of numeric values.
+    /// \tparam T Requested destination type for conversion, should be unsigned integral type.
+    /// \param buffer Fields separated by \p delimiter, e.g. "0xAB,12,FF". Empty buffer holds no fields.
+    /// \param delimiter Character separating consecutive fields.
+    /// \param column Converted values are appended here, one per field (0 for invalid fields).
+    /// \param errors Error bitmap appended in parallel to \p column; true marks field which couldn't be converted.
+    /// \return Number of fields which couldn't be converted.
+    /// \remark Both \p column and \p errors are appended to, each after its own existing elements, even if their sizes differ.
+    template <typename T>
+    size_t convertHexStrings(std::string_view buffer, char delimiter, std::vector<T> &column, std::vector<bool> &errors)
+    {
+        static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value,
+                      "'T' should be unsigned integral type.");
+
+        if (buffer.empty())
+        {
+            return 0;
+        }
+
+        const auto fieldsCount = static_cast<size_t>(std::count(buffer.cbegin(), buffer.cend(), delimiter)) + 1;
+        column.reserve(column.size() + fieldsCount);
+        errors.reserve(errors.size() + fieldsCount);
+
+        size_t errorsCount{0};
+        while (true)
+        {
+            const size_t fieldEnd = buffer.find(delimiter);
+            T value{};
+            const bool converted = tryConvertHexString<T>(buffer.substr(0, fieldEnd), value);
+            column.push_back(value);
+            errors.push_back(!converted);
+            errorsCount += converted ? 0 : 1;
+
+            if (fieldEnd == std::string_view::npos)
+            {
+                break;
+            }
+            buffer.remove_prefix(fieldEnd + 1);
+        }
+        return errorsCount;
+    }
+
+    /// Base64 alphabet variants.
+    enum class base64_alphabet_t
+    {
+        standard,
+        url_safe
+    };
+
+    /// Text representations of UUID.
+    enum class uuid_format_t
+    {
+        canonical, ///< 8-4-4-4-12 hex digits separated with dashes, e.g. 123e4567-e89b-12d3-a456-426614174000
+        braced,    ///< canonical form enclosed in curly braces, e.g. {123e4567-e89b-12d3-a456-426614174000}
+        compact    ///< 32 hex digits without any separators, e.g. 123e4567e89b12d3a456426614174000
+    };
+
+    /// Maximal number of characters written by formatDecimal for the type \p T (sign included).
+    template <typename T>
+    inline constexpr size_t maxDecimalLength = std::numeric_limits<T>::digits10 + 1 + (std::is_signed<T>::value ? 1 : 0);
+
+    /// Convert decimal string to a numeric value without throwing, without allocation and without locale.
+    /// \tparam T Requested destination type for conversion, should be integral type.
+    /// \param decimalString Input decimal string. Could contains leading zeros and the '-' sign for signed \p T.
+    /// \param value Output for the converted value; left untouched if the conversion fails.
+    /// \return True if whole \p decimalString is a valid decimal value which fits into type \p T, false otherwise.
+    /// \remark Eight digits at once are validated and converted with SWAR arithmetic.
+    template <typename T>
+    bool parseDecimal(std::string_view decimalString, T &value) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "'T' should be fundamental integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        bool negative{false};
+        if constexpr (std::is_signed<T>::value)
+        {
+            if (startsWith(decimalString, '-'))
+            {
+                negative = true;
+                decimalString.remove_prefix(1);
+            }
+        }
+
+        if (decimalString.empty())
+        {
+            return false;
+        }
+
+        const char *current = decimalString.data();
+        const char *const last = current + decimalString.size() - 1;
+
+        // all digits except the last one fit into uint64_t as long as there are at most 19 of them:
+        while (current < last && *current == '0')
+        {
+            ++current;
+        }
+        if (last - current > std::numeric_limits<uint64_t>::digits10)
+        {
+            return false;
+        }
+
+        uint64_t accumulator{0};
+        while (last - current >= 8)
+        {
+            const uint64_t chunk = detail::loadEightChars(current);
+            if (!detail::isEightDigits(chunk))
+            {
+                return false;
+            }
+            accumulator = accumulator * 100000000u + detail::parseEightDigits(chunk);
+            current += 8;
+        }
+        for (; current <= last; ++current)
+        {
+            const auto digit = static_cast<uint8_t>(*current - '0');
+            if (digit > 9)
+            {
+                return false;
+            }
+            if (accumulator > (std::numeric_limits<uint64_t>::max() - digit) / 10u)
+            {
+                return false;
+            }
+            accumulator = accumulator * 10u + digit;
+        }
+
+        using UnsignedT = std::make_unsigned_t<T>;
+        constexpr auto maxMagnitude = static_cast<uint64_t>(std::numeric_limits<T>::max());
+        if (negative)
+        {
+            if (accumulator > maxMagnitude + 1u)
+            {
+                return false;
+            }
+            value = static_cast<T>(static_cast<UnsignedT>(0u - accumulator));
+        }
+        else
+        {
+            if (accumulator > maxMagnitude)
+            {
+                return false;
+            }
+            value = static_cast<T>(accumulator);
+        }
+        return true;
+    }
+
+    /// Convert numeric value to its decimal representation, without allocation and without locale.
+    /// \tparam T Type of the converted value, should be integral type.
+    /// \param value Value to be converted.
+    /// \param destination Output buffer, should have room for at least maxDecimalLength<T> characters. No null terminator is written.
+    /// \return Number of characters written to the \p destination.
+    /// \remark Two digits at once are written with the help of a lookup table.
+    template <typename T>
+    size_t formatDecimal(T value, char *destination) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "'T' should be fundamental integral type.");
+        static_assert(!std::is_same<T, bool>::value, "'T' should not be the boolean type.");
+
+        size_t written{0};
+        auto magnitude = static_cast<uint64_t>(value);
+        if constexpr (std::is_signed<T>::value)
+        {
+            if (value < 0)
+            {
+                destination[written++] = '-';
+                magnitude = 0u - magnitude;
+            }
+        }
+
+        const size_t digits = detail::countDecimalDigits(magnitude);
+        written += digits;
+
+        char *current = destination + written;
+        while (magnitude >= 100u)
+        {
+            const uint64_t pair = (magnitude % 100u) * 2u;
+            magnitude /= 100u;
+            *--current = detail::decimalDigitPairs[pair + 1];
+            *--current = detail::decimalDigitPairs[pair];
+        }
+        if (magnitude >= 10u)
+        {
+            const uint64_t pair = magnitude * 2u;
+            *--current = detail::decimalDigitPairs[pair + 1];
+            *--current = detail::decimalDigitPairs[pair];
+        }
+        else
+        {
+            *--current = static_cast<char>('0' + magnitude);
+        }
+        return written;
+    }
+
+    /// Calculate number of characters needed to encode \p bytesCount bytes in Base64.
+    /// \param bytesCount Number of bytes to be encoded.
+    /// \param padding Whether the encoded text is padded with '=' to the multiple of 4 characters.
+    /// \return Length of the encoded text.
+    constexpr size_t base64EncodedLength(size_t bytesCount, bool padding = true) noexcept
+    {
+        if (padding)
+        {
+            return (bytesCount + 2) / 3 * 4;
+        }
+        return bytesCount / 3 * 4 + (bytesCount % 3 == 0 ? 0 : bytesCount % 3 + 1);
+    }
+
+    /// Calculate maximal number of bytes which could be decoded from \p charactersCount characters of Base64 text.
+    /// \param charactersCount Length of the encoded text.
+    /// \return Size of the buffer sufficient for decoding.
+    constexpr size_t base64DecodedMaxLength(size_t charactersCount) noexcept
+    {
+        return charactersCount / 4 * 3 + (charactersCount % 4) * 3 / 4;
+    }
+
+    /// Encode binary data as Base64 text.
+    /// \param source Data to be encoded.
+    /// \param size Number of bytes to be encoded.
+    /// \param destination Output buffer, should have room for at least base64EncodedLength(size, padding) characters. No null terminator is written.
+    /// \param alphabet Alphabet used for encoding.
+    /// \param padding Whether the text should be padded with '=' to the multiple of 4 characters.
+    /// \return Number of characters written to the \p destination.
+    inline size_t encodeBase64(const uint8_t *source, size_t size, char *destination,
+                               base64_alphabet_t alphabet = base64_alphabet_t::standard, bool padding = true) noexcept
+    {
+        const auto &characters = detail::base64Alphabets[static_cast<size_t>(alphabet)];
+        const size_t groupsCount = size / 3;
+        detail::encodeBase64Groups(source, groupsCount, destination, characters);
+        return groupsCount * 4 + detail::encodeBase64Tail(source + groupsCount * 3, size % 3, destination + groupsCount * 4, characters, padding);
+    }
+
+    /// Decode Base64 text to binary data with strict validation.
+    /// \param encoded Text to be decoded. Characters outside of the \p alphabet (including whitespaces) make it invalid.
+    /// \param destination Output buffer, should have room for at least base64DecodedMaxLength(encoded.size()) bytes.
+    /// \param written Number of bytes written to the \p destination.
+    /// \param alphabet Alphabet used for decoding.
+    /// \param padding Whether the text has to be padded with '=' to the multiple of 4 characters (true) or has to be unpadded (false).
+    /// \return True if the whole \p encoded text is valid Base64, false otherwise.
+    /// \remark Non-zero unused bits of the last character are treated as an error, so each binary data has exactly one valid encoding.
+    inline bool decodeBase64(std::string_view encoded, uint8_t *destination, size_t &written,
+                             base64_alphabet_t alphabet = base64_alphabet_t::standard, bool padding = true) noexcept
+    {
+        written = 0;
+        if (padding)
+        {
+            if (encoded.size() % 4 != 0)
+            {
+                return false;
+            }
+            encoded.remove_suffix(detail::countBase64Padding(encoded));
+        }
+
+        const auto &characters = detail::base64Alphabets[static_cast<size_t>(alphabet)];
+        const auto &values = detail::base64Values[static_cast<size_t>(alphabet)];
+        const size_t groupsCount = encoded.size() / 4;
+        if (detail::decodeBase64Groups(encoded.data(), groupsCount, destination, characters, values) != groupsCount)
+        {
+            return false;
+        }
+
+        size_t tailWritten{0};
+        const bool valid = detail::decodeBase64Tail(encoded.data() + groupsCount * 4, encoded.size() % 4, destination + groupsCount * 3, tailWritten, values);
+        written = valid ? groupsCount * 3 + tailWritten : 0;
+        return valid;
+    }
+
+    /// Streaming Base64 encoder - data could be given in chunks of any size.
+    class Base64Encoder
+    {
+    public:
+        /// Create encoder.
+        /// \param alphabet Alphabet used for encoding.
+        /// \param padding Whether the text should be padded with '=' to the multiple of 4 characters.
+        explicit Base64Encoder(base64_alphabet_t alphabet = base64_alphabet_t::standard, bool padding = true) noexcept
+                : alphabet_{detail::base64Alphabets[static_cast<size_t>(alphabet)]}, padding_{padding}
+        {
+        }
+
+        /// Encode next chunk of data. Up to 2 trailing bytes of the chunk are kept until the next call.
+        /// \param source Data to be encoded.
+        /// \param size Number of bytes to be encoded.
+        /// \param destination Output buffer, should have room for at least base64EncodedLength(size + 2) characters.
+        /// \return Number of characters written to the \p destination.
+        size_t update(const uint8_t *source, size_t size, char *destination) noexcept
+        {
+            size_t written{0};
+            if (pendingCount_ > 0)
+            {
+                while (pendingCount_ < pending_.size() && size > 0)
+                {
+                    pending_[pendingCount_++] = *source++;
+                    --size;
+                }
+                if (pendingCount_ < pending_.size())
+                {
+                    return 0;
+                }
+                detail::encodeBase64Groups(pending_.data(), 1, destination, alphabet_);
+                pendingCount_ = 0;
+                written += 4;
+            }
+
+            const size_t groupsCount = size / 3;
+            detail::encodeBase64Groups(source, groupsCount, destination + written, alphabet_);
+            written += groupsCount * 4;
+
+            for (size_t i = groupsCount * 3; i < size; ++i)
+            {
+                pending_[pendingCount_++] = source[i];
+            }
+            return written;
+        }
+
+        /// Encode bytes kept from the previous chunks and reset the encoder.
+        /// \param destination Output buffer, should have room for at least 4 characters.
+        /// \return Number of characters written to the \p destination.
+        size_t finish(char *destination) noexcept
+        {
+            const size_t written = detail::encodeBase64Tail(pending_.data(), pendingCount_, destination, alphabet_, padding_);
+            pendingCount_ = 0;
+            return written;
+        }
+
+    private:
+        const std::array<char, 64> &alphabet_;
+        bool padding_;
+        std::array<uint8_t, 3> pending_{};
+        size_t pendingCount_{0};
+    };
+
+    /// Streaming Base64 decoder with strict validation - text could be given in chunks of any size.
+    class Base64Decoder
+    {
+    public:
+        /// Create decoder.
+        /// \param alphabet Alphabet used for decoding.
+        /// \param padding Whether the text has to be padded with '=' to the multiple of 4 characters (true) or has to be unpadded (false).
+        explicit Base64Decoder(base64_alphabet_t alphabet = base64_alphabet_t::standard, bool padding = true) noexcept
+                : alphabet_{detail::base64Alphabets[static_cast<size_t>(alphabet)]}, values_{detail::base64Values[static_cast<size_t>(alphabet)]}
+                , padding_{padding}
+        {
+        }
+
+        /// Decode next chunk of text. Up to 3 trailing characters of the chunk are kept until the next call.
+        /// \param chunk Text to be decoded.
+        /// \param destination Output buffer, should have room for at least base64DecodedMaxLength(chunk.size() + 3) bytes.
+        /// \param written Number of bytes written to the \p destination.
+        /// \return False if the text given so far isn't valid Base64; the decoder has to be reset with finish() then.
+        bool update(std::string_view chunk, uint8_t *destination, size_t &written) noexcept
+        {
+            written = 0;
+            if (failed_ || (finished_ && !chunk.empty()))
+            {
+                failed_ = true;
+                return false;
+            }
+
+            if (pendingCount_ > 0)
+            {
+                while (pendingCount_ < pending_.size() && !chunk.empty())
+                {
+                    pending_[pendingCount_++] = chunk.front();
+                    chunk.remove_prefix(1);
+                }
+                if (pendingCount_ < pending_.size())
+                {
+                    return true;
+                }
+                pendingCount_ = 0;
+                if (!decodeGroups({pending_.data(), pending_.size()}, destination, written) || (finished_ && !chunk.empty()))
+                {
+                    failed_ = true;
+                    return false;
+                }
+            }
+
+            const size_t wholeGroupsLength = chunk.size() / 4 * 4;
+            size_t groupsWritten{0};
+            if (!decodeGroups(chunk.substr(0, wholeGroupsLength), destination + written, groupsWritten))
+            {
+                failed_ = true;
+                return false;
+            }
+            written += groupsWritten;
+
+            chunk.remove_prefix(wholeGroupsLength);
+            if (finished_ && !chunk.empty())
+            {
+                failed_ = true;
+                return false;
+            }
+            for (const char character : chunk)
+            {
+                pending_[pendingCount_++] = character;
+            }
+            return true;
+        }
+
+        /// Decode characters kept from the previous chunks and reset the decoder.
+        /// \param destination Output buffer, should have room for at least 2 bytes.
+        /// \param written Number of bytes written to the \p destination.
+        /// \return True if the whole text given to the decoder was valid Base64, false otherwise.
+        bool finish(uint8_t *destination, size_t &written) noexcept
+        {
+            written = 0;
+            bool valid = !failed_;
+            if (valid && pendingCount_ > 0)
+            {
+                valid = !padding_ && detail::decodeBase64Tail(pending_.data(), pendingCount_, destination, written, values_);
+            }
+
+            pendingCount_ = 0;
+            finished_ = false;
+            failed_ = false;
+            return valid;
+        }
+
+    private:
+        /// Decode whole groups of \p text; the padded group ends the stream.
+        bool decodeGroups(std::string_view text, uint8_t *destination, size_t &written) noexcept
+        {
+            const size_t groupsCount = text.size() / 4;
+            const size_t decodedCount = detail::decodeBase64Groups(text.data(), groupsCount, destination, alphabet_, values_);
+            written = decodedCount * 3;
+            if (decodedCount == groupsCount)
+            {
+                return true;
+            }
+
+            // only the last group of the whole stream could contain padding:
+            std::string_view lastGroup = text.substr(decodedCount * 4, 4);
+            const size_t paddingCount = detail::countBase64Padding(lastGroup);
+            if (!padding_ || paddingCount == 0 || decodedCount + 1 != groupsCount)
+            {
+                return false;
+            }
+
+            lastGroup.remove_suffix(paddingCount);
+            size_t tailWritten{0};
+            if (!detail::decodeBase64Tail(lastGroup.data(), lastGroup.size(), destination + written, tailWritten, values_))
+            {
+                return false;
+            }
+            written += tailWritten;
+            finished_ = true;
+            return true;
+        }
+
+        const std::array<char, 64> &alphabet_;
+        const std::array<uint8_t, 256> &values_;
+        bool padding_;
+        std::array<char, 4> pending_{};
+        size_t pendingCount_{0};
+        bool finished_{false};
+        bool failed_{false};
+    };
+
+    /// Encode binary data as hex text, two characters per byte.
+    /// \param source Data to be encoded.
+    /// \param size Number of bytes to be encoded.
+    /// \param destination Output buffer, should have room for at least 2 * size characters. No null terminator is written.
+    /// \param uppercase Whether the hex digits above 9 should be uppercase.
+    /// \return Number of characters written to the \p destination.
+    /// \remark Uses AVX2 when the CPU supports it (detected at runtime), encoding 32 bytes at once; scalar loop otherwise.
+    inline size_t encodeHex(const uint8_t *source, size_t size, char *destination, bool uppercase = false) noexcept
+    {
+        size_t encoded{0};
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if (size >= 32 && container::detail::hasAvx2())
+        {
+            encoded = detail::encodeHexAvx2(source, size, destination, uppercase);
+        }
+#endif
+        detail::encodeHexScalar(source + encoded, size - encoded, destination + 2 * encoded, uppercase);
+        return 2 * size;
+    }
+
+    /// Write hexdump of binary data (in the format of 'hexdump -C') to the \p sink.
+    /// Output is formatted into a fixed-size buffer on the stack and passed to the \p sink block by block,
+    /// so no memory is allocated regardless of the size of \p data.
+    /// \tparam Sink Callable type accepting std::string_view.
+    /// \param data Data to be dumped.
+    /// \param size Number of bytes to be dumped.
+    /// \param sink Receiver of the consecutive blocks of text; each block consists of whole lines.
+    /// \param baseOffset Offset printed for the first byte of \p data.
+    template <class Sink>
+    void hexDump(const uint8_t *data, size_t size, Sink &&sink, uint64_t baseOffset = 0)
+    {
+        constexpr size_t bytesPerLine = 16;
+        constexpr size_t linesPerBlock = 64;
+        // the longest line: 16 digits of offset, separators, hex bytes, text column between '|' and the new line:
+        constexpr size_t maxLineLength = 16 + 1 + 2 + 3 * bytesPerLine + 2 + bytesPerLine + 2;
+
+        const size_t offsetDigits = (baseOffset + size) > std::numeric_limits<uint32_t>::max() ? 16 : 8;
+        std::array<char, maxLineLength * linesPerBlock> block{};
+
+        while (size > 0)
+        {
+            size_t blockLength{0};
+            for (size_t line = 0; line < linesPerBlock && size > 0; ++line)
+            {
+                const size_t lineSize = std::min(size, bytesPerLine);
+                blockLength += detail::writeHexDumpLine(baseOffset, offsetDigits, data, lineSize, block.data() + blockLength);
+                data += lineSize;
+                size -= lineSize;
+                baseOffset += lineSize;
+            }
+            sink(std::string_view{block.data(), blockLength});
+        }
+    }
+
+    /// Calculate number of characters of the UUID written in the given \p format.
+    /// \param format Text representation of UUID.
+    /// \return Length of the UUID text.
+    constexpr size_t uuidLength(uuid_format_t format = uuid_format_t::canonical) noexcept
+    {
+        switch (format)
+        {
+            case uuid_format_t::braced:
+                return 38;
+            case uuid_format_t::compact:
+                return 32;
+            case uuid_format_t::canonical:
+            default:
+                return 36;
+        }
+    }
+
+    /// Parse UUID text without throwing and without any allocation.
+    /// \param text UUID in any of the uuid_format_t forms (recognized by the length); hex digits could be lower or uppercase.
+    /// \param uuid Output for the 16 bytes of parsed UUID, in the order of appearance in \p text.
+    /// \return True if \p text is a valid UUID, false otherwise.
+    inline bool parseUuid(std::string_view text, std::array<uint8_t, 16> &uuid) noexcept
+    {
+        if (text.size() == uuidLength(uuid_format_t::braced))
+        {
+            if (text.front() != '{' || text.back() != '}')
+            {
+                return false;
+            }
+            text = text.substr(1, uuidLength(uuid_format_t::canonical));
+        }
+
+        const bool dashed = text.size() == uuidLength(uuid_format_t::canonical);
+        if (dashed)
+        {
+            if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-')
+            {
+                return false;
+            }
+        }
+        else if (text.size() != uuidLength(uuid_format_t::compact))
+        {
+            return false;
+        }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if (detail::hasSsse3())
+        {
+            return detail::decodeUuidSsse3(text, dashed, uuid);
+        }
+#endif
+        return detail::decodeUuidScalar(text, dashed, uuid);
+    }
+
+    /// Write UUID as a text, using lowercase hex digits.
+    /// \param uuid 16 bytes of UUID.
+    /// \param destination Output buffer, should have room for at least uuidLength(format) characters. No null terminator is written.
+    /// \param format Requested text representation.
+    /// \return Number of characters written to the \p destination.
+    inline size_t formatUuid(const std::array<uint8_t, 16> &uuid, char *destination, uuid_format_t format = uuid_format_t::canonical) noexcept
+    {
+        const bool braced = format == uuid_format_t::braced;
+        const bool dashed = format != uuid_format_t::compact;
+        char *current = destination;
+        if (braced)
+        {
+            *current++ = '{';
+        }
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if (detail::hasSsse3())
+        {
+            current += detail::encodeUuidSsse3(uuid, dashed, current);
+        }
+        else
+#endif
+        {
+            current += detail::encodeUuidScalar(uuid, dashed, current);
+        }
+        if (braced)
+        {
+            *current++ = '}';
+        }
+        return static_cast<size_t>(current - destination);
+    }
+}
@@ -25,8 +25,18 @@
 #include "../external/Catch2/single_include/catch2/catch.hpp"
 #include "../src/toolbox/containers/query.hpp"
 #include "../src/toolbox/containers/remove.hpp"
+#include "../src/toolbox/containers/membership.hpp"
+#include "../src/toolbox/containers/set_operations.hpp"
 #include <vector>
 #include <list>
+#include <forward_list>
+#include <deque>
+#include <stdexcept>
+#include <memory>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
 
 TEST_CASE("Container: - containsAny", "[container][query]")
 {
@@ -276,6 +286,17 @@ TEST_CASE("Container: - removeElementInPlace", "[container][remove]")
         REQUIRE_NOTHROW(toolbox::container::removeElementInPlace(empty_list, 1));
         REQUIRE(empty_list.empty());
     }
+
+    SECTION("std::list element aliasing the source")
+    {
+        std::list<std::string> source{"a", "b", "a", "c", "a"};
+        toolbox::container::removeElementInPlace(source, source.front());
+        REQUIRE(source == std::list<std::string>{"b", "c"});
+
+        std::list<int> numbers{1, 2, 3};
+        toolbox::container::removeElementInPlace(numbers, 2.5);
+        REQUIRE(numbers == std::list<int>{1, 2, 3});
+    }
 }
 
 TEST_CASE("Container: - removeElementsInPlace", "[container][remove]")
@@ -321,4 +342,936 @@ TEST_CASE("Container: - removeElementsInPlace", "[container][remove]")
         REQUIRE_NOTHROW(toolbox::container::removeElementsInPlace(empty_list, empty_list));
         REQUIRE(empty_list.empty());
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Container: - MembershipIndex", "[container][membership]")
+{
+    using toolbox::container::MembershipIndex;
+    using toolbox::container::membership_strategy_t;
+
+    const auto checkAllStrategies = [](const auto &elements, const auto &probes)
+    {
+        using container_t = std::remove_cv_t<std::remove_reference_t<decltype(elements)>>;
+        for (const auto strategy : {membership_strategy_t::linear, membership_strategy_t::bitmap,
+                                    membership_strategy_t::hash, membership_strategy_t::sorted})
+        {
+            const MembershipIndex<container_t> index{elements, strategy};
+            for (const auto &probe : probes)
+            {
+                REQUIRE(index.contains(probe) == (std::find(elements.cbegin(), elements.cend(), probe) != elements.cend()));
+            }
+        }
+    };
+
+    SECTION("Strategy selection")
+    {
+        std::vector<int> tiny{1, 2, 3};
+        REQUIRE(MembershipIndex<std::vector<int>>{tiny, 1000}.strategy() == membership_strategy_t::linear);
+
+        std::vector<int> dense(5000);
+        std::iota(dense.begin(), dense.end(), -2500);
+        REQUIRE(MembershipIndex<std::vector<int>>{dense, 3}.strategy() == membership_strategy_t::linear);
+        REQUIRE(MembershipIndex<std::vector<int>>{dense, 10000}.strategy() == membership_strategy_t::bitmap);
+
+        std::vector<uint64_t> sparse(5000);
+        for (size_t i = 0; i < sparse.size(); ++i)
+        {
+            sparse[i] = i * 0x9E3779B97F4A7C15u;
+        }
+        REQUIRE(MembershipIndex<std::vector<uint64_t>>{sparse, 10000}.strategy() == membership_strategy_t::hash);
+
+        std::vector<std::string> strings(100, "text");
+        REQUIRE(MembershipIndex<std::vector<std::string>>{strings, 100}.strategy() == membership_strategy_t::hash);
+
+        std::vector<std::pair<int, int>> pairs(100);
+        REQUIRE(MembershipIndex<std::vector<std::pair<int, int>>>{pairs, 100}.strategy() == membership_strategy_t::sorted);
+        REQUIRE(MembershipIndex<std::vector<std::pair<int, int>>>{pairs, membership_strategy_t::hash}.strategy() ==
+                membership_strategy_t::sorted);
+        REQUIRE(MembershipIndex<std::vector<uint64_t>>{sparse, membership_strategy_t::bitmap}.strategy() ==
+                membership_strategy_t::hash);
+    }
+
+    SECTION("Integral elements, all strategies")
+    {
+        const std::vector<int> elements{-100, 7, 3, 3, 250, -1, 0, 99, 42, 1000, 12};
+        std::vector<int> probes(1400);
+        std::iota(probes.begin(), probes.end(), -200);
+        checkAllStrategies(elements, probes);
+
+        const std::list<uint8_t> bytes{0, 255, 128, 17};
+        std::vector<uint8_t> allBytes(256);
+        std::iota(allBytes.begin(), allBytes.end(), 0);
+        checkAllStrategies(bytes, allBytes);
+
+        const std::vector<int64_t> extremes{std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 0};
+        checkAllStrategies(extremes, std::vector<int64_t>{std::numeric_limits<int64_t>::min(), -1, 0, 1,
+                                                          std::numeric_limits<int64_t>::max()});
+    }
+
+    SECTION("Non-scalar elements, all strategies")
+    {
+        const std::vector<std::string> elements{"alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta", "iota"};
+        checkAllStrategies(elements, std::vector<std::string>{"", "alpha", "zeta", "omega", "iota", "Beta"});
+
+        const std::vector<std::pair<int, int>> pairs{{1, 2}, {2, 1}, {3, 3}, {-1, 0}};
+        checkAllStrategies(pairs, std::vector<std::pair<int, int>>{{1, 2}, {1, 1}, {3, 3}, {0, -1}});
+
+        const std::vector<double> reals{0.5, -1.25, 3.0};
+        checkAllStrategies(reals, std::vector<double>{0.5, 0.0, 3.0, -1.0});
+    }
+
+    SECTION("Large inputs through containsAny and containsOnly")
+    {
+        std::vector<int> whitelist(5000);
+        std::iota(whitelist.begin(), whitelist.end(), 0);
+        std::vector<int> source(10000);
+        for (size_t i = 0; i < source.size(); ++i)
+        {
+            source[i] = static_cast<int>((i * 7919) % whitelist.size());
+        }
+        REQUIRE(toolbox::container::containsOnly(source, whitelist));
+        REQUIRE(toolbox::container::containsAny(source, whitelist));
+
+        source.back() = 5000;
+        REQUIRE_FALSE(toolbox::container::containsOnly(source, whitelist));
+        REQUIRE(toolbox::container::containsAny(source, whitelist));
+
+        std::vector<std::string> words;
+        std::vector<std::string> others;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            words.push_back("word" + std::to_string(i));
+            others.push_back("other" + std::to_string(i));
+        }
+        REQUIRE(toolbox::container::containsOnly(words, words));
+        REQUIRE_FALSE(toolbox::container::containsAny(words, others));
+        others.push_back("word999");
+        REQUIRE(toolbox::container::containsAny(words, others));
+        REQUIRE_FALSE(toolbox::container::containsOnly(others, words));
+    }
+}
+
+namespace
+{
+    struct CopyCounted
+    {
+        static size_t copies;
+
+        explicit CopyCounted(int value) : value_{value}
+        {
+        }
+
+        CopyCounted(const CopyCounted &other) : value_{other.value_}
+        {
+            ++copies;
+        }
+
+        CopyCounted(CopyCounted &&) noexcept = default;
+        CopyCounted &operator=(const CopyCounted &other)
+        {
+            value_ = other.value_;
+            ++copies;
+            return *this;
+        }
+
+        CopyCounted &operator=(CopyCounted &&) noexcept = default;
+        ~CopyCounted() = default;
+
+        bool operator==(const CopyCounted &other) const
+        {
+            return value_ == other.value_;
+        }
+
+        int value_;
+    };
+
+    size_t CopyCounted::copies = 0;
+}
+
+template <>
+struct std::hash<CopyCounted>
+{
+    size_t operator()(const CopyCounted &element) const noexcept
+    {
+        return std::hash<int>{}(element.value_);
+    }
+};
+
+TEST_CASE("Container: - removeElements, removeElementsInPlace with large blacklists", "[container][remove]")
+{
+    std::vector<std::string> blacklist;
+    std::vector<std::string> source;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        blacklist.push_back("banned" + std::to_string(i));
+        source.push_back("user" + std::to_string(i));
+        source.push_back("banned" + std::to_string(i * 3));
+    }
+
+    SECTION("std::string elements")
+    {
+        const auto result = toolbox::container::removeElements(source, blacklist);
+        REQUIRE(result.size() == 2000 + 1333);
+        REQUIRE(result[0] == "user0");
+        REQUIRE(result[1] == "user1");
+        REQUIRE(result.back() == "banned5997");
+        REQUIRE_FALSE(toolbox::container::containsAny(result, blacklist));
+
+        auto inPlace = source;
+        toolbox::container::removeElementsInPlace(inPlace, blacklist);
+        REQUIRE(inPlace == result);
+    }
+
+    SECTION("Elements aren't copied")
+    {
+        std::vector<CopyCounted> elements;
+        std::vector<CopyCounted> toRemove;
+        for (int i = 0; i < 1000; ++i)
+        {
+            elements.emplace_back(i);
+            toRemove.emplace_back(2 * i);
+        }
+
+        CopyCounted::copies = 0;
+        toolbox::container::removeElementsInPlace(elements, toRemove);
+        REQUIRE(CopyCounted::copies == 0);
+        REQUIRE(elements.size() == 500);
+        REQUIRE(elements.front().value_ == 1);
+        REQUIRE(elements.back().value_ == 999);
+
+        const auto result = toolbox::container::removeElements(elements, std::vector<CopyCounted>{CopyCounted{1}});
+        REQUIRE(result.size() == 499);
+        // only the kept elements are copied into the result:
+        REQUIRE(CopyCounted::copies == 499 + 1);
+    }
+
+    SECTION("Blacklist aliasing the source")
+    {
+        auto elements = source;
+        toolbox::container::removeElementsInPlace(elements, elements);
+        REQUIRE(elements.empty());
+    }
+}
+
+TEST_CASE("Container: - sorted_range containsAny, containsOnly, removeElements", "[container][sorted]")
+{
+    using toolbox::container::sorted_range;
+
+    const auto makeSorted = [](size_t count, uint32_t step, uint32_t seed)
+    {
+        std::vector<uint32_t> values(count);
+        uint32_t value{seed};
+        for (auto &current : values)
+        {
+            value += 1 + (value * 2654435761u >> 28u) % step;
+            current = value;
+        }
+        return values;
+    };
+
+    SECTION("Corner cases")
+    {
+        std::vector<int> empty;
+        std::vector<int> not_empty{1, 2, 3};
+        REQUIRE(toolbox::container::containsAny(sorted_range, empty, empty));
+        REQUIRE_FALSE(toolbox::container::containsAny(sorted_range, not_empty, empty));
+        REQUIRE_FALSE(toolbox::container::containsAny(sorted_range, empty, not_empty));
+        REQUIRE(toolbox::container::containsOnly(sorted_range, empty, empty));
+        REQUIRE_FALSE(toolbox::container::containsOnly(sorted_range, not_empty, empty));
+        REQUIRE_FALSE(toolbox::container::containsOnly(sorted_range, empty, not_empty));
+        REQUIRE(toolbox::container::removeElements(sorted_range, not_empty, empty) == not_empty);
+        REQUIRE(toolbox::container::removeElements(sorted_range, empty, not_empty).empty());
+    }
+
+    SECTION("Duplicates and mixed containers")
+    {
+        std::list<int> source{-5, -5, 1, 2, 2, 2, 7, 9, 9};
+        std::vector<int> blacklist{-5, 2, 3, 9};
+        REQUIRE(toolbox::container::removeElements(sorted_range, source, blacklist) == std::list<int>{1, 7});
+        REQUIRE(toolbox::container::containsAny(sorted_range, source, blacklist));
+        REQUIRE_FALSE(toolbox::container::containsOnly(sorted_range, source, blacklist));
+        REQUIRE(toolbox::container::containsOnly(sorted_range, source, std::vector<int>{-5, 1, 2, 7, 9}));
+        REQUIRE(toolbox::container::containsOnly(sorted_range, std::vector<double>{1.0, 7.0}, source));
+        REQUIRE_FALSE(toolbox::container::containsAny(sorted_range, std::vector<double>{1.5, 7.5}, source));
+    }
+
+    SECTION("Same results as unsorted versions, merging, galloping and SIMD")
+    {
+        for (const auto &sizes : std::vector<std::pair<size_t, size_t>>{{3, 5}, {17, 19}, {100, 1000}, {1000, 100}, {5, 5000},
+                                                                       {5000, 5}, {2000, 3000}})
+        {
+            for (uint32_t seed = 0; seed < 20; ++seed)
+            {
+                const auto first = makeSorted(sizes.first, 64, seed);
+                const auto second = makeSorted(sizes.second, 16, seed * 7 + 1);
+                const std::list<uint32_t> firstList(first.cbegin(), first.cend());
+
+                REQUIRE(toolbox::container::containsAny(sorted_range, first, second) == toolbox::container::containsAny(first, second));
+                REQUIRE(toolbox::container::containsAny(sorted_range, firstList, second) == toolbox::container::containsAny(first, second));
+                REQUIRE(toolbox::container::containsOnly(sorted_range, first, second) == toolbox::container::containsOnly(first, second));
+                REQUIRE(toolbox::container::removeElements(sorted_range, first, second) == toolbox::container::removeElements(first, second));
+                REQUIRE(toolbox::container::removeElements(sorted_range, firstList, second) == toolbox::container::removeElements(firstList, second));
+
+                const std::vector<uint32_t> subset(second.cbegin() + static_cast<std::ptrdiff_t>(second.size() / 3), second.cend());
+                REQUIRE(toolbox::container::containsOnly(sorted_range, subset, second));
+                REQUIRE(toolbox::container::containsAny(sorted_range, subset, second));
+                REQUIRE(toolbox::container::containsAny(sorted_range, second, std::vector<uint32_t>{second.back()}));
+                REQUIRE(toolbox::container::containsAny(sorted_range, std::vector<uint32_t>{second.front()}, second));
+            }
+        }
+    }
+
+    SECTION("Signed 32-bit integers")
+    {
+        const std::vector<int32_t> first{-100, -50, -3, 0, 4, 8, 15, 16, 23, 42};
+        const std::vector<int32_t> second{-99, -49, -2, 1, 5, 9, 14, 17, 22, 43, 100};
+        REQUIRE_FALSE(toolbox::container::containsAny(sorted_range, first, second));
+        REQUIRE(toolbox::container::containsAny(sorted_range, first, std::vector<int32_t>{-100, 200, 300, 400}));
+        REQUIRE(toolbox::container::containsAny(sorted_range, first, std::vector<int32_t>{-200, -150, -120, 42}));
+    }
+}
+
+TEST_CASE("Container: - parallel contains, containsAny", "[container][parallel]")
+{
+    using toolbox::container::parallel;
+    using toolbox::container::parallel_t;
+
+    std::vector<uint32_t> source(1000000);
+    std::iota(source.begin(), source.end(), 0u);
+
+    SECTION("contains, match at any position")
+    {
+        for (const uint32_t position : std::vector<uint32_t>{0, 1, 65535, 65536, 500000, 999999})
+        {
+            REQUIRE(toolbox::container::contains(parallel, source, position));
+            REQUIRE(toolbox::container::contains(parallel_t{4}, source, position));
+            REQUIRE(toolbox::container::contains(parallel_t{3}, source, position));
+        }
+        REQUIRE_FALSE(toolbox::container::contains(parallel, source, 1000000u));
+        REQUIRE_FALSE(toolbox::container::contains(parallel_t{7}, source, 1000000u));
+    }
+
+    SECTION("containsAny")
+    {
+        REQUIRE(toolbox::container::containsAny(parallel_t{4}, source, std::vector<uint32_t>{2000000, 999999}));
+        REQUIRE(toolbox::container::containsAny(parallel_t{4}, source, std::vector<uint32_t>(100, 123456)));
+        REQUIRE_FALSE(toolbox::container::containsAny(parallel_t{4}, source, std::vector<uint32_t>{1000000, 1000001}));
+        REQUIRE(toolbox::container::containsAny(parallel_t{4}, source, std::vector<double>{999999.0}));
+        REQUIRE_FALSE(toolbox::container::containsAny(parallel_t{4}, source, std::vector<double>{0.5, 999999.5}));
+    }
+
+    SECTION("Small and non random access containers, corner cases")
+    {
+        std::list<int> list{1, 2, 3};
+        std::vector<int> empty;
+        REQUIRE(toolbox::container::contains(parallel, list, 2));
+        REQUIRE_FALSE(toolbox::container::contains(parallel, empty, 2));
+        REQUIRE(toolbox::container::containsAny(parallel, list, std::vector<int>{3}));
+        REQUIRE(toolbox::container::containsAny(parallel, empty, empty));
+        REQUIRE_FALSE(toolbox::container::containsAny(parallel, list, empty));
+        REQUIRE_FALSE(toolbox::container::containsAny(parallel, empty, list));
+    }
+
+    SECTION("Exception thrown by comparison in the calling thread or in a worker")
+    {
+        struct ThrowingValue
+        {
+            uint32_t value;
+
+            bool operator==(uint32_t other) const
+            {
+                if (value == 7 || value == 900000)
+                {
+                    throw std::runtime_error{"comparison failed"};
+                }
+                return value == other;
+            }
+        };
+
+        std::vector<ThrowingValue> values(source.size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i].value = source[i];
+        }
+        // the first part is checked by the calling thread, the last one by a worker:
+        REQUIRE_THROWS_AS(toolbox::container::contains(parallel_t{4}, values, 1000000u), std::runtime_error);
+        values[7].value = 8;
+        REQUIRE_THROWS_AS(toolbox::container::contains(parallel_t{4}, values, 1000000u), std::runtime_error);
+        values[900000].value = 8;
+        REQUIRE_FALSE(toolbox::container::contains(parallel_t{4}, values, 1000000u));
+    }
+}
+
+namespace
+{
+    template <class T>
+    void checkFindIndexAtAllPositions()
+    {
+        for (size_t size = 0; size < 300; size += size < 70 ? 1 : 23)
+        {
+            std::vector<T> values(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                values[i] = static_cast<T>(i % 100 + 1);
+            }
+            REQUIRE_FALSE(toolbox::container::findIndex(values, T{0}).has_value());
+            REQUIRE_FALSE(toolbox::container::contains(values, T{0}));
+            for (size_t position = 0; position < size; ++position)
+            {
+                values[position] = T{0};
+                REQUIRE(toolbox::container::findIndex(values, T{0}) == position);
+                REQUIRE(toolbox::container::contains(values, T{0}));
+                values[position] = static_cast<T>(position % 100 + 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("Container: - findIndex, contains with SIMD", "[container][query][simd]")
+{
+    SECTION("All element types, all positions")
+    {
+        checkFindIndexAtAllPositions<uint8_t>();
+        checkFindIndexAtAllPositions<int8_t>();
+        checkFindIndexAtAllPositions<uint16_t>();
+        checkFindIndexAtAllPositions<int16_t>();
+        checkFindIndexAtAllPositions<uint32_t>();
+        checkFindIndexAtAllPositions<int32_t>();
+        checkFindIndexAtAllPositions<uint64_t>();
+        checkFindIndexAtAllPositions<int64_t>();
+        checkFindIndexAtAllPositions<float>();
+        checkFindIndexAtAllPositions<double>();
+    }
+
+    SECTION("Only whole 64-bit elements are compared")
+    {
+        const std::vector<uint64_t> values{0x100000000u, 0x1u, 0x200000001u, 0x100000001u};
+        REQUIRE(toolbox::container::findIndex(values, uint64_t{0x100000001u}) == 3u);
+        REQUIRE_FALSE(toolbox::container::findIndex(values, uint64_t{0x200000000u}).has_value());
+    }
+
+    SECTION("Mixed types give the same results as operator==")
+    {
+        const std::vector<uint8_t> bytes{1, 44, 255};
+        REQUIRE_FALSE(toolbox::container::contains(bytes, 300));
+        REQUIRE(toolbox::container::contains(bytes, 255));
+        REQUIRE_FALSE(toolbox::container::contains(bytes, -1));
+
+        const std::vector<uint32_t> unsignedValues{0, 0xFFFFFFFFu};
+        REQUIRE(toolbox::container::findIndex(unsignedValues, -1) == 1u);
+
+        const std::vector<int16_t> shorts{-1, 1};
+        REQUIRE_FALSE(toolbox::container::contains(shorts, uint16_t{65535}));
+        REQUIRE(toolbox::container::contains(shorts, int64_t{-1}));
+
+        const std::vector<int> ints{1, 2, 3};
+        REQUIRE_FALSE(toolbox::container::contains(ints, 1.5));
+        REQUIRE(toolbox::container::findIndex(ints, 3.0) == 2u);
+    }
+
+    SECTION("Floating point semantics")
+    {
+        const std::vector<double> values{std::numeric_limits<double>::quiet_NaN(), -0.0, 1.0};
+        REQUIRE_FALSE(toolbox::container::contains(values, std::numeric_limits<double>::quiet_NaN()));
+        REQUIRE(toolbox::container::findIndex(values, 0.0) == 1u);
+    }
+
+    SECTION("Types which don't fit SIMD lanes are searched with std::find")
+    {
+        const std::vector<long double> values{1.5L, 2.25L, 3.0L};
+        REQUIRE(toolbox::container::contains(values, 2.25L));
+        REQUIRE(toolbox::container::findIndex(values, 3.0L) == 2u);
+        REQUIRE_FALSE(toolbox::container::contains(values, 2.0L));
+        REQUIRE(toolbox::container::contains(toolbox::container::parallel, values, 1.5L));
+        static_assert(!toolbox::container::detail::is_simd_searchable_v<std::vector<long double>, long double>);
+        static_assert(!toolbox::container::detail::is_simd_searchable_v<std::vector<int>, long double>);
+    }
+
+    SECTION("Non-contiguous containers")
+    {
+        const std::list<int> values{5, 6, 7};
+        REQUIRE(toolbox::container::findIndex(values, 7) == 2u);
+        REQUIRE_FALSE(toolbox::container::findIndex(values, 8).has_value());
+    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    SECTION("Both instruction sets")
+    {
+        std::vector<uint16_t> values(1000, 7);
+        values[777] = 9;
+        REQUIRE(toolbox::container::detail::findEqualSse2(values.data(), values.size(), uint16_t{9}) == 777);
+        REQUIRE(toolbox::container::detail::findEqualSse2(values.data(), values.size(), uint16_t{8}) == values.size());
+        if (toolbox::container::detail::hasAvx2())
+        {
+            REQUIRE(toolbox::container::detail::findEqualAvx2(values.data(), values.size(), uint16_t{9}) == 777);
+            REQUIRE(toolbox::container::detail::findEqualAvx2(values.data(), values.size(), uint16_t{8}) == values.size());
+        }
+    }
+#endif
+}
+
+namespace
+{
+    size_t allocationsCount{0};
+
+    template <class T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        CountingAllocator() = default;
+
+        template <class U>
+        explicit CountingAllocator(const CountingAllocator<U> &) noexcept
+        {
+        }
+
+        T *allocate(size_t count)
+        {
+            ++allocationsCount;
+            return std::allocator<T>{}.allocate(count);
+        }
+
+        void deallocate(T *pointer, size_t count) noexcept
+        {
+            std::allocator<T>{}.deallocate(pointer, count);
+        }
+
+        template <class U>
+        bool operator==(const CountingAllocator<U> &) const noexcept
+        {
+            return true;
+        }
+
+        template <class U>
+        bool operator!=(const CountingAllocator<U> &) const noexcept
+        {
+            return false;
+        }
+    };
+}
+
+TEST_CASE("Container: - removeElements, removeElement allocations", "[container][remove]")
+{
+    using counted_vector = std::vector<int, CountingAllocator<int>>;
+    using counted_string = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+    using counted_list = std::list<int, CountingAllocator<int>>;
+
+    counted_vector source;
+    for (int i = 0; i < 10000; ++i)
+    {
+        source.push_back(i % 10);
+    }
+    const std::vector<int> blacklist{1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+
+    SECTION("Contiguous results are allocated once")
+    {
+        // growing by std::back_inserter alone took an allocation per capacity doubling, 14 for 5000 elements
+        allocationsCount = 0;
+        const auto withoutBlacklisted = toolbox::container::removeElements(source, blacklist);
+        REQUIRE(withoutBlacklisted.size() == 5000);
+        REQUIRE(allocationsCount == 1);
+
+        allocationsCount = 0;
+        const auto withoutZeros = toolbox::container::removeElement(source, 0);
+        REQUIRE(withoutZeros.size() == 9000);
+        REQUIRE(withoutZeros.capacity() == 9000);
+        REQUIRE(allocationsCount == 1);
+
+        const counted_string text(1000, 'x');
+        allocationsCount = 0;
+        REQUIRE(toolbox::container::removeElement(text, 'y') == text);
+        REQUIRE(allocationsCount == 1);
+    }
+
+    SECTION("Mostly emptied results don't keep capacity of the whole source")
+    {
+        const std::vector<int> mostOfDigits{0, 1, 2, 3, 4, 5, 6, 7, 8};
+        allocationsCount = 0;
+        const auto onlyNines = toolbox::container::removeElements(source, mostOfDigits);
+        REQUIRE(onlyNines.size() == 1000);
+        REQUIRE(onlyNines.capacity() < source.size() / 4);
+        REQUIRE(allocationsCount == 2);
+
+        auto sortedSource = source;
+        std::sort(sortedSource.begin(), sortedSource.end());
+        const auto sortedOnlyNines = toolbox::container::removeElements(toolbox::container::sorted_range, sortedSource, mostOfDigits);
+        REQUIRE(sortedOnlyNines == onlyNines);
+        REQUIRE(sortedOnlyNines.capacity() < source.size() / 4);
+
+        const auto withoutOnes = toolbox::container::removeElements(source, std::vector<int>{1});
+        REQUIRE(withoutOnes.capacity() == source.size());
+
+        const auto partitions = toolbox::container::partitionElements(source, mostOfDigits);
+        REQUIRE(partitions.first == onlyNines);
+        REQUIRE(partitions.first.capacity() < source.size() / 4);
+    }
+
+    SECTION("Temporary sources are reused")
+    {
+        auto copy = source;
+        const auto *buffer = copy.data();
+        allocationsCount = 0;
+        const auto result = toolbox::container::removeElements(std::move(copy), blacklist);
+        REQUIRE(allocationsCount == 0);
+        REQUIRE(result.data() == buffer);
+        REQUIRE(result == toolbox::container::removeElements(source, blacklist));
+
+        counted_list list(source.cbegin(), source.cend());
+        const auto *firstKept = &*std::next(list.cbegin(), 2);
+        allocationsCount = 0;
+        const auto listResult = toolbox::container::removeElement(std::move(list), 1);
+        REQUIRE(allocationsCount == 0);
+        REQUIRE(listResult.size() == 9000);
+        REQUIRE(&*std::next(listResult.cbegin(), 1) == firstKept);
+
+        allocationsCount = 0;
+        const auto blacklistedListResult = toolbox::container::removeElements(counted_list(source.cbegin(), source.cend()), blacklist);
+        REQUIRE(allocationsCount == 10000);
+        REQUIRE(blacklistedListResult.size() == 5000);
+        REQUIRE_FALSE(toolbox::container::containsAny(blacklistedListResult, blacklist));
+    }
+
+    SECTION("Lvalue sources are left untouched")
+    {
+        counted_list list{1, 2, 3, 1};
+        const auto result = toolbox::container::removeElement(list, 1);
+        REQUIRE(list.size() == 4);
+        REQUIRE(result == counted_list{2, 3});
+    }
+}
+
+TEST_CASE("Container: - partitionElements, partitionElementsInPlace", "[container][remove][partition]")
+{
+    using toolbox::container::partition_order_t;
+
+    SECTION("Both groups in one pass")
+    {
+        const std::vector<int> source{1, 2, 3, 4, 1, 2, 3, 4};
+        const std::vector<int> toRemove{1, 3};
+        const auto [kept, removed] = toolbox::container::partitionElements(source, toRemove);
+        REQUIRE(kept == std::vector<int>{2, 4, 2, 4});
+        REQUIRE(removed == std::vector<int>{1, 3, 1, 3});
+        REQUIRE(kept == toolbox::container::removeElements(source, toRemove));
+
+        const std::list<int> list{1, 2, 3};
+        const auto listPartitions = toolbox::container::partitionElements(list, std::vector<double>{2.0});
+        REQUIRE(listPartitions.first == std::list<int>{1, 3});
+        REQUIRE(listPartitions.second == std::list<int>{2});
+
+        const std::vector<int> empty;
+        REQUIRE(toolbox::container::partitionElements(empty, toRemove).first.empty());
+        REQUIRE(toolbox::container::partitionElements(source, empty).first == source);
+    }
+
+    SECTION("Large inputs")
+    {
+        std::vector<std::string> source;
+        std::vector<std::string> blacklist;
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            source.push_back("id" + std::to_string(i));
+            blacklist.push_back("id" + std::to_string(i * 2));
+        }
+        const auto partitions = toolbox::container::partitionElements(source, blacklist);
+        REQUIRE(partitions.first == toolbox::container::removeElements(source, blacklist));
+        REQUIRE(partitions.second.size() == 1500);
+        REQUIRE(partitions.second.back() == "id2998");
+    }
+
+    SECTION("In-place, stable")
+    {
+        std::vector<int> source{1, 2, 3, 4, 5, 6, 7, 8, 9};
+        const auto split = toolbox::container::partitionElementsInPlace(source, std::vector<int>{2, 3, 5, 7});
+        REQUIRE(std::vector<int>(source.begin(), split) == std::vector<int>{1, 4, 6, 8, 9});
+        REQUIRE(std::vector<int>(split, source.end()) == std::vector<int>{2, 3, 5, 7});
+
+        std::list<int> list{5, 1, 5, 2};
+        const auto listSplit = toolbox::container::partitionElementsInPlace(list, std::list<int>{5});
+        list.erase(listSplit, list.end());
+        REQUIRE(list == std::list<int>{1, 2});
+    }
+
+    SECTION("In-place, unstable")
+    {
+        std::vector<int> source(2000);
+        std::iota(source.begin(), source.end(), 0);
+        std::vector<int> blacklist(500);
+        std::iota(blacklist.begin(), blacklist.end(), 1000);
+
+        const auto split = toolbox::container::partitionElementsInPlace(source, blacklist, partition_order_t::unstable);
+        REQUIRE(split - source.begin() == 1500);
+        REQUIRE_FALSE(toolbox::container::containsAny(std::vector<int>(source.begin(), split), blacklist));
+        REQUIRE(toolbox::container::containsOnly(std::vector<int>(split, source.end()), blacklist));
+    }
+
+    SECTION("In-place, blacklist aliasing the source")
+    {
+        std::vector<std::string> source{"a", "b"};
+        REQUIRE(toolbox::container::partitionElementsInPlace(source, source) == source.begin());
+        REQUIRE(source.size() == 2);
+    }
+}
+
+TEST_CASE("Container: - setIntersection, setDifference, setUnion, setSymmetricDifference", "[container][set_operations]")
+{
+    using namespace toolbox::container;
+
+    SECTION("Small containers keep order and duplicates of the first one")
+    {
+        const std::vector<int> first{5, 1, 5, 3, 8, 2};
+        const std::vector<int> second{2, 9, 5, 7};
+
+        REQUIRE(setIntersection(first, second) == std::vector<int>{5, 5, 2});
+        REQUIRE(setDifference(first, second) == std::vector<int>{1, 3, 8});
+        REQUIRE(setDifference(first, second) == removeElements(first, second));
+        REQUIRE(setUnion(first, second) == std::vector<int>{5, 1, 5, 3, 8, 2, 9, 7});
+        REQUIRE(setSymmetricDifference(first, second) == std::vector<int>{1, 3, 8, 9, 7});
+    }
+
+    SECTION("Empty containers")
+    {
+        const std::vector<int> empty;
+        const std::vector<int> some{1, 2};
+        REQUIRE(setIntersection(empty, some).empty());
+        REQUIRE(setIntersection(some, empty).empty());
+        REQUIRE(setDifference(some, empty) == some);
+        REQUIRE(setUnion(empty, some) == some);
+        REQUIRE(setSymmetricDifference(some, empty) == some);
+    }
+
+    SECTION("Large containers match removeElements for every strategy")
+    {
+        for (const size_t spread: {size_t{2}, size_t{1000}})
+        {
+            std::vector<long> first(5000);
+            std::vector<long> second(3000);
+            for (size_t i = 0; i < first.size(); ++i)
+            {
+                first[i] = static_cast<long>((i * 7919u) % (first.size() * spread));
+            }
+            for (size_t i = 0; i < second.size(); ++i)
+            {
+                second[i] = static_cast<long>((i * 104729u) % (first.size() * spread));
+            }
+
+            const auto difference = setDifference(first, second);
+            const auto intersection = setIntersection(first, second);
+            REQUIRE(difference == removeElements(first, second));
+            REQUIRE(intersection == removeElements(first, difference));
+            REQUIRE(difference.size() + intersection.size() == first.size());
+
+            const auto united = setUnion(first, second);
+            REQUIRE(std::vector<long>(united.begin(), united.begin() + 5000) == first);
+            REQUIRE(containsOnly(united, first) == false);
+            REQUIRE(std::vector<long>(united.begin() + 5000, united.end()) == removeElements(second, first));
+        }
+    }
+
+    SECTION("Output iterator variants")
+    {
+        const std::list<std::string> first{"a", "b", "c"};
+        const std::vector<std::string> second{"c", "d"};
+
+        std::vector<std::string> output;
+        setIntersection(first, second, std::back_inserter(output));
+        REQUIRE(output == std::vector<std::string>{"c"});
+
+        std::string buffer[5];
+        const auto end = setUnion(first, second, std::begin(buffer));
+        REQUIRE(end - std::begin(buffer) == 4);
+        REQUIRE(buffer[3] == "d");
+
+        REQUIRE(setSymmetricDifference(first, second) == std::list<std::string>{"a", "b", "d"});
+    }
+
+    SECTION("Mixed element types")
+    {
+        const std::vector<int> first{1, 2, 3, 4};
+        const std::vector<long> second{2L, 4L, 6L};
+        REQUIRE(setIntersection(first, second) == std::vector<int>{2, 4});
+        REQUIRE(setDifference(first, second) == std::vector<int>{1, 3});
+    }
+}
+
+TEST_CASE("Container: - BlockedBloomFilter, bloom_filter containsAny, containsOnly, removeElements", "[container][bloom_filter]")
+{
+    using namespace toolbox::container;
+
+    SECTION("Blocked Bloom filter has no false negatives and keeps the false positive rate")
+    {
+        std::vector<uint64_t> inserted(20000);
+        for (size_t i = 0; i < inserted.size(); ++i)
+        {
+            inserted[i] = i * 2;
+        }
+        for (const double rate : {0.1, 0.01, 0.001})
+        {
+            BlockedBloomFilter<uint64_t> filter{inserted.size(), bloom_filter_t{rate}};
+            for (const auto value : inserted)
+            {
+                filter.insert(value);
+            }
+            REQUIRE(std::all_of(inserted.cbegin(), inserted.cend(), [&filter](uint64_t value)
+            {
+                return filter.mayContain(value);
+            }));
+
+            size_t falsePositives{0};
+            const size_t probes{200000};
+            for (size_t i = 0; i < probes; ++i)
+            {
+                falsePositives += filter.mayContain(i * 2 + 1) ? 1u : 0u;
+            }
+            REQUIRE(static_cast<double>(falsePositives) / static_cast<double>(probes) < rate * 1.5);
+        }
+    }
+
+    SECTION("Smaller rate gives bigger filter")
+    {
+        const BlockedBloomFilter<std::string> coarse{1000, bloom_filter_t{0.1}};
+        const BlockedBloomFilter<std::string> fine{1000, bloom_filter_t{0.0001}};
+        REQUIRE(coarse.sizeInBytes() < fine.sizeInBytes());
+        REQUIRE(BlockedBloomFilter<int>{0, bloom_filter}.sizeInBytes() == 64);
+    }
+
+    SECTION("Invalid false positive rate")
+    {
+        REQUIRE_THROWS_AS(bloom_filter_t{0.0}, std::invalid_argument);
+        REQUIRE_THROWS_AS(bloom_filter_t{1.0}, std::invalid_argument);
+    }
+
+    SECTION("Membership index with prefilter")
+    {
+        std::vector<std::string> blacklist;
+        for (size_t i = 0; i < 3000; ++i)
+        {
+            blacklist.push_back("id" + std::to_string(i * 3));
+        }
+        const MembershipIndex<std::vector<std::string>> index{blacklist, 1000, bloom_filter};
+        REQUIRE(index.prefiltered());
+        REQUIRE(index.contains("id2997"));
+        REQUIRE_FALSE(index.contains("id2998"));
+
+        const std::vector<int> dense{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        REQUIRE_FALSE((MembershipIndex<std::vector<int>>{dense, 1000, bloom_filter}.prefiltered()));
+    }
+
+    SECTION("Entry points give the same results as without the filter")
+    {
+        std::vector<long> blacklist(5000);
+        std::vector<long> source(4000);
+        for (size_t i = 0; i < blacklist.size(); ++i)
+        {
+            blacklist[i] = static_cast<long>(i * 1000003u);
+        }
+        for (size_t i = 0; i < source.size(); ++i)
+        {
+            source[i] = static_cast<long>(i * 999983u);
+        }
+
+        REQUIRE(removeElements(bloom_filter, source, blacklist) == removeElements(source, blacklist));
+        REQUIRE(containsAny(bloom_filter, source, blacklist) == containsAny(source, blacklist));
+        REQUIRE_FALSE(containsOnly(bloom_filter, source, blacklist));
+        REQUIRE(containsOnly(bloom_filter_t{0.2}, blacklist, blacklist));
+
+        auto inPlace = source;
+        removeElementsInPlace(bloom_filter, inPlace, blacklist);
+        REQUIRE(inPlace == removeElements(source, blacklist));
+        removeElementsInPlace(bloom_filter, inPlace, inPlace);
+        REQUIRE(inPlace.empty());
+
+        const std::vector<long> disjoint{-1, -2, -3};
+        REQUIRE_FALSE(containsAny(bloom_filter, disjoint, blacklist));
+        REQUIRE(containsAny(bloom_filter, std::vector<long>{}, std::vector<long>{}));
+        REQUIRE_FALSE(containsOnly(bloom_filter, std::vector<long>{}, blacklist));
+
+        std::list<std::string> words{"a", "b", "c"};
+        removeElementsInPlace(bloom_filter, words, std::vector<std::string>{"b"});
+        REQUIRE(words == std::list<std::string>{"a", "c"});
+    }
+}
+
+TEST_CASE("Container: - removeDuplicatesInPlace", "[container][remove]")
+{
+    using toolbox::container::removeDuplicatesInPlace;
+
+    SECTION("Small inputs")
+    {
+        std::vector<int> ids{7, 3, 7, 1, 3};
+        removeDuplicatesInPlace(ids);
+        REQUIRE(ids == std::vector<int>{7, 3, 1});
+
+        std::vector<int> empty;
+        removeDuplicatesInPlace(empty);
+        REQUIRE(empty.empty());
+
+        std::string text{"mississippi"};
+        removeDuplicatesInPlace(text);
+        REQUIRE(text == "misp");
+    }
+
+    SECTION("Large inputs keep the first occurrences in order")
+    {
+        std::vector<uint64_t> ids(10000);
+        std::vector<uint64_t> expected;
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            ids[i] = (i * 7919u) % 3001u;
+            if (std::find(expected.cbegin(), expected.cend(), ids[i]) == expected.cend())
+            {
+                expected.push_back(ids[i]);
+            }
+        }
+        removeDuplicatesInPlace(ids);
+        REQUIRE(ids.size() == 3001);
+        REQUIRE(ids == expected);
+
+        std::vector<std::string> words;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            words.push_back("event-" + std::to_string(i % 250));
+        }
+        removeDuplicatesInPlace(words);
+        REQUIRE(words.size() == 250);
+        REQUIRE(words.front() == "event-0");
+        REQUIRE(words.back() == "event-249");
+    }
+
+    SECTION("Node based containers")
+    {
+        std::list<std::string> words;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            words.push_back(std::to_string(99 - i % 40));
+        }
+        const auto firstKept = &words.front();
+        removeDuplicatesInPlace(words);
+        REQUIRE(words.size() == 40);
+        REQUIRE(&words.front() == firstKept);
+        REQUIRE(words.back() == "60");
+
+        std::forward_list<int> ids{4, 4, 2, 4, 1, 2};
+        removeDuplicatesInPlace(ids);
+        REQUIRE(ids == std::forward_list<int>{4, 2, 1});
+
+        std::deque<int> queue{1, 1, 1};
+        removeDuplicatesInPlace(queue);
+        REQUIRE(queue == std::deque<int>{1});
+    }
+
+    SECTION("Types which aren't hashable")
+    {
+        std::vector<std::pair<int, int>> pairs;
+        for (int i = 0; i < 100; ++i)
+        {
+            pairs.emplace_back(i % 5, i % 3);
+        }
+        removeDuplicatesInPlace(pairs);
+        REQUIRE(pairs.size() == 15);
+        REQUIRE(pairs[1] == std::pair<int, int>{1, 1});
+
+        std::list<std::pair<int, int>> list{{1, 2}, {1, 2}, {2, 1}};
+        removeDuplicatesInPlace(list);
+        REQUIRE(list == std::list<std::pair<int, int>>{{1, 2}, {2, 1}});
+    }
+}
@@ -25,6 +25,15 @@
 #include "../external/Catch2/single_include/catch2/catch.hpp"
 
 #include "../src/toolbox/memory/chopping.hpp"
+#include "../src/toolbox/memory/binary_cursor.hpp"
+#include "../src/toolbox/memory/varint.hpp"
+#include "../src/toolbox/memory/schema.hpp"
+#include "../src/toolbox/memory/bit_stream.hpp"
+#include "../src/toolbox/memory/checksum.hpp"
+
+#include <cstring>
+#include <utility>
+#include <vector>
 
 TEST_CASE("Memory: endianness", "[memory][endianness]")
 {
@@ -281,4 +290,885 @@ TEST_CASE("Memory: splicing, uint64_t -> uint8_t", "[memory][chopping][sliceToCh
         REQUIRE(spliced[6] == std::numeric_limits<small_t>::max());
         REQUIRE(spliced[7] == std::numeric_limits<small_t>::max());
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Memory: byte swapping - byteswap", "[memory][endianness]")
+{
+    REQUIRE(toolbox::memory::byteswap(uint8_t{0xAB}) == 0xAB);
+    REQUIRE(toolbox::memory::byteswap(uint16_t{0xDEAD}) == 0xADDE);
+    REQUIRE(toolbox::memory::byteswap(uint32_t{0xDEADBEEF}) == 0xEFBEADDE);
+    REQUIRE(toolbox::memory::byteswap(uint64_t{0xDeadBeefAbbaBabe}) == 0xBEBABAABEFBEADDE);
+    static_assert(toolbox::memory::byteswap(uint32_t{0x01020304}) == 0x04030201);
+}
+
+TEST_CASE("Memory: bulk splicing of many values - sliceToChunks", "[memory][chopping][sliceToChunks]")
+{
+    using toolbox::memory::endianness_t;
+    const std::vector<uint64_t> values{0xDeadBeefAbbaBabe, 0, 1, std::numeric_limits<uint64_t>::max(), 0x0102030405060708};
+
+    SECTION("uint64_t -> uint8_t, big endian order matches single value slicing")
+    {
+        std::vector<uint8_t> chunks(values.size() * 8);
+        REQUIRE(toolbox::memory::sliceToChunks<uint8_t>(values.data(), values.size(), chunks.data()) == chunks.data() + chunks.size());
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const auto expected = toolbox::memory::sliceToChunks<uint8_t>(values[i]);
+            REQUIRE(std::equal(expected.cbegin(), expected.cend(), chunks.cbegin() + static_cast<std::ptrdiff_t>(i * 8)));
+        }
+    }
+
+    SECTION("uint64_t -> uint16_t, big endian order matches single value slicing")
+    {
+        std::vector<uint16_t> chunks(values.size() * 4);
+        toolbox::memory::sliceToChunks<uint16_t, endianness_t::big>(values.data(), values.size(), chunks.data());
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const auto expected = toolbox::memory::sliceToChunks<uint16_t>(values[i]);
+            REQUIRE(std::equal(expected.cbegin(), expected.cend(), chunks.cbegin() + static_cast<std::ptrdiff_t>(i * 4)));
+        }
+    }
+
+    SECTION("Little endian order is reversed single value slicing")
+    {
+        std::vector<uint8_t> bytes(values.size() * 8);
+        toolbox::memory::sliceToChunks<uint8_t, endianness_t::little>(values.data(), values.size(), bytes.data());
+        std::vector<uint16_t> words(values.size() * 4);
+        toolbox::memory::sliceToChunks<uint16_t, endianness_t::little>(values.data(), values.size(), words.data());
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const auto expectedBytes = toolbox::memory::sliceToChunks<uint8_t>(values[i]);
+            REQUIRE(std::equal(expectedBytes.crbegin(), expectedBytes.crend(), bytes.cbegin() + static_cast<std::ptrdiff_t>(i * 8)));
+
+            const auto expectedWords = toolbox::memory::sliceToChunks<uint16_t>(values[i]);
+            REQUIRE(std::equal(expectedWords.crbegin(), expectedWords.crend(), words.cbegin() + static_cast<std::ptrdiff_t>(i * 4)));
+        }
+    }
+
+    SECTION("uint32_t -> uint8_t, pattern")
+    {
+        const std::array<uint32_t, 2> words{0xDEADBEEF, 0x01020304};
+        std::array<uint8_t, 8> bytes{};
+        toolbox::memory::sliceToChunks<uint8_t>(words.data(), words.size(), bytes.data());
+        REQUIRE(bytes == std::array<uint8_t, 8>{0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04});
+
+        toolbox::memory::sliceToChunks<uint8_t, endianness_t::little>(words.data(), words.size(), bytes.data());
+        REQUIRE(bytes == std::array<uint8_t, 8>{0xEF, 0xBE, 0xAD, 0xDE, 0x04, 0x03, 0x02, 0x01});
+    }
+
+    SECTION("Empty input")
+    {
+        std::array<uint8_t, 1> bytes{0x55};
+        REQUIRE(toolbox::memory::sliceToChunks<uint8_t>(values.data(), 0, bytes.data()) == bytes.data());
+        REQUIRE(bytes[0] == 0x55);
+    }
+}
+
+TEST_CASE("Memory: joining chunks - joinChunks", "[memory][chopping][joinChunks]")
+{
+    using toolbox::memory::endianness_t;
+
+    SECTION("Single value patterns")
+    {
+        REQUIRE(toolbox::memory::joinChunks<uint16_t>(std::array<uint8_t, 2>{0xDE, 0xAD}) == 0xDEAD);
+        REQUIRE(toolbox::memory::joinChunks<uint32_t>(std::array<uint8_t, 4>{0xDE, 0xAD, 0xBE, 0xEF}) == 0xDEADBEEF);
+        REQUIRE(toolbox::memory::joinChunks<uint32_t>(std::array<uint16_t, 2>{0xDEAD, 0xBEEF}) == 0xDEADBEEF);
+        REQUIRE(toolbox::memory::joinChunks<uint64_t>(std::array<uint16_t, 4>{0xDEAD, 0xBEEF, 0xABBA, 0xBABE}) == 0xDeadBeefAbbaBabe);
+        static_assert(toolbox::memory::joinChunks<uint16_t>(std::array<uint8_t, 2>{0x01, 0x02}) == 0x0102);
+    }
+
+    SECTION("Bulk patterns")
+    {
+        const std::array<uint8_t, 8> bytes{0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04};
+        std::array<uint32_t, 2> words{};
+
+        REQUIRE(toolbox::memory::joinChunks(bytes.data(), words.size(), words.data()) == bytes.data() + bytes.size());
+        REQUIRE(words == std::array<uint32_t, 2>{0xDEADBEEF, 0x01020304});
+
+        toolbox::memory::joinChunks<uint32_t, endianness_t::little>(bytes.data(), words.size(), words.data());
+        REQUIRE(words == std::array<uint32_t, 2>{0xEFBEADDE, 0x04030201});
+
+        std::array<uint16_t, 4> halves{};
+        toolbox::memory::joinChunks<uint16_t, endianness_t::little>(bytes.data(), halves.size(), halves.data());
+        REQUIRE(halves == std::array<uint16_t, 4>{0xADDE, 0xEFBE, 0x0201, 0x0403});
+    }
+
+    SECTION("Round trip with sliceToChunks")
+    {
+        std::vector<uint64_t> values(1000);
+        uint64_t state{42};
+        for (auto &value : values)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            value = state;
+        }
+
+        for (const auto value : values)
+        {
+            REQUIRE(toolbox::memory::joinChunks<uint64_t>(toolbox::memory::sliceToChunks<uint8_t>(value)) == value);
+            REQUIRE(toolbox::memory::joinChunks<uint64_t>(toolbox::memory::sliceToChunks<uint32_t>(value)) == value);
+            const auto narrow = static_cast<uint16_t>(value);
+            REQUIRE(toolbox::memory::joinChunks<uint16_t>(toolbox::memory::sliceToChunks<uint8_t>(narrow)) == narrow);
+        }
+
+        std::vector<uint8_t> bytes(values.size() * 8);
+        std::vector<uint16_t> words(values.size() * 4);
+        std::vector<uint64_t> joined(values.size());
+
+        toolbox::memory::sliceToChunks<uint8_t, endianness_t::big>(values.data(), values.size(), bytes.data());
+        toolbox::memory::joinChunks<uint64_t, endianness_t::big>(bytes.data(), joined.size(), joined.data());
+        REQUIRE(joined == values);
+
+        toolbox::memory::sliceToChunks<uint8_t, endianness_t::little>(values.data(), values.size(), bytes.data());
+        toolbox::memory::joinChunks<uint64_t, endianness_t::little>(bytes.data(), joined.size(), joined.data());
+        REQUIRE(joined == values);
+
+        toolbox::memory::sliceToChunks<uint16_t, endianness_t::big>(values.data(), values.size(), words.data());
+        toolbox::memory::joinChunks<uint64_t, endianness_t::big>(words.data(), joined.size(), joined.data());
+        REQUIRE(joined == values);
+
+        toolbox::memory::sliceToChunks<uint16_t, endianness_t::little>(values.data(), values.size(), words.data());
+        toolbox::memory::joinChunks<uint64_t, endianness_t::little>(words.data(), joined.size(), joined.data());
+        REQUIRE(joined == values);
+    }
+}
+
+TEST_CASE("Memory: byte order conversion - toBigEndian, toLittleEndian", "[memory][endianness]")
+{
+    auto bytesOf = [](auto value)
+    {
+        std::array<uint8_t, sizeof(value)> bytes{};
+        std::memcpy(bytes.data(), &value, sizeof(value));
+        return bytes;
+    };
+
+    SECTION("Integral values")
+    {
+        REQUIRE(bytesOf(toolbox::memory::toBigEndian(uint32_t{0xDEADBEEF})) == std::array<uint8_t, 4>{0xDE, 0xAD, 0xBE, 0xEF});
+        REQUIRE(bytesOf(toolbox::memory::toLittleEndian(uint32_t{0xDEADBEEF})) == std::array<uint8_t, 4>{0xEF, 0xBE, 0xAD, 0xDE});
+        REQUIRE(bytesOf(toolbox::memory::toBigEndian(int16_t{-2})) == std::array<uint8_t, 2>{0xFF, 0xFE});
+        REQUIRE(toolbox::memory::toBigEndian(toolbox::memory::toBigEndian(uint64_t{0xDeadBeefAbbaBabe})) == 0xDeadBeefAbbaBabe);
+        REQUIRE(toolbox::memory::byteswap(int32_t{0x01020304}) == 0x04030201);
+    }
+
+    SECTION("Floating point values")
+    {
+        const double value{3.14};
+        const auto swapped = toolbox::memory::byteswap(value);
+        auto expected = bytesOf(value);
+        std::reverse(expected.begin(), expected.end());
+        REQUIRE(bytesOf(swapped) == expected);
+        REQUIRE(toolbox::memory::byteswap(swapped) == value);
+
+        REQUIRE(toolbox::memory::toLittleEndian(toolbox::memory::toLittleEndian(2.5f)) == 2.5f);
+        REQUIRE(bytesOf(toolbox::memory::toBigEndian(1.0f)) == std::array<uint8_t, 4>{0x3F, 0x80, 0x00, 0x00});
+    }
+
+    SECTION("Buffers in place")
+    {
+        std::vector<uint16_t> words{0x0102, 0xA0B0, 0xFFFE};
+        toolbox::memory::byteswapInPlace(words.data(), words.size());
+        REQUIRE(words == std::vector<uint16_t>{0x0201, 0xB0A0, 0xFEFF});
+
+        std::vector<uint32_t> values(1000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<uint32_t>(i * 2654435761u);
+        }
+        const auto original = values;
+
+        toolbox::memory::toBigEndianInPlace(values.data(), values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            REQUIRE(bytesOf(values[i]) == toolbox::memory::sliceToChunks<uint8_t>(original[i]));
+        }
+        toolbox::memory::toBigEndianInPlace(values.data(), values.size());
+        REQUIRE(values == original);
+
+        toolbox::memory::toLittleEndianInPlace(values.data(), values.size());
+        toolbox::memory::toLittleEndianInPlace(values.data(), values.size());
+        REQUIRE(values == original);
+
+        std::vector<double> doubles{1.5, -2.25, 1e300};
+        toolbox::memory::byteswapInPlace(doubles.data(), doubles.size());
+        REQUIRE(toolbox::memory::byteswap(doubles[1]) == -2.25);
+        toolbox::memory::byteswapInPlace(doubles.data(), doubles.size());
+        REQUIRE(doubles == std::vector<double>{1.5, -2.25, 1e300});
+    }
+
+    SECTION("Buffers of all lengths, at all alignments")
+    {
+        std::vector<uint8_t> bytes(300);
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(i * 151 + 7);
+        }
+
+        const auto check = [&bytes](auto element)
+        {
+            using T = decltype(element);
+            for (size_t offset = 0; offset < 8; offset += 3)
+            {
+                for (size_t count = 0; (offset + count * sizeof(T)) <= bytes.size(); count += 1 + count / 8)
+                {
+                    std::vector<T> values(count);
+                    std::memcpy(values.data(), bytes.data() + offset, count * sizeof(T));
+                    toolbox::memory::byteswapInPlace(values.data(), values.size());
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        T expected{};
+                        std::memcpy(&expected, bytes.data() + offset + i * sizeof(T), sizeof(T));
+                        REQUIRE(values[i] == toolbox::memory::byteswap(expected));
+                    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+                    if (toolbox::memory::detail::hasAvx2())
+                    {
+                        std::vector<uint8_t> unaligned(bytes);
+                        const size_t swapped = toolbox::memory::detail::byteswapElementsAvx2<sizeof(T)>(unaligned.data() + offset, count);
+                        toolbox::memory::detail::byteswapElementsScalar<sizeof(T)>(unaligned.data() + offset + swapped * sizeof(T), count - swapped);
+                        std::vector<uint8_t> expectedBytes(bytes);
+                        toolbox::memory::detail::byteswapElementsScalar<sizeof(T)>(expectedBytes.data() + offset, count);
+                        REQUIRE(unaligned == expectedBytes);
+                    }
+#endif
+                }
+            }
+        };
+        check(uint16_t{});
+        check(uint32_t{});
+        check(uint64_t{});
+        check(int64_t{});
+    }
+}
+
+TEST_CASE("Memory: endian-tagged storage types - big_endian, little_endian", "[memory][endianness]")
+{
+    using toolbox::memory::big_endian;
+    using toolbox::memory::little_endian;
+
+    static_assert(sizeof(big_endian<uint32_t>) == 4);
+    static_assert(alignof(big_endian<uint64_t>) == 1);
+    static_assert(std::is_trivially_copyable<little_endian<double>>::value);
+
+    struct WireHeader
+    {
+        big_endian<uint16_t> type{};
+        big_endian<uint32_t> length{};
+        little_endian<uint16_t> flags{};
+        big_endian<float> ratio{};
+    };
+    static_assert(sizeof(WireHeader) == 12);
+
+    SECTION("Reading fields of the buffer overlay")
+    {
+        const std::array<uint8_t, 12> buffer{0x00, 0x2A, 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x3F, 0x80, 0x00, 0x00};
+        WireHeader header;
+        std::memcpy(&header, buffer.data(), sizeof(header));
+
+        REQUIRE(header.type == 42);
+        REQUIRE(header.length.load() == 0xDEADBEEF);
+        REQUIRE(header.flags == 0x0201);
+        REQUIRE(header.ratio == 1.0f);
+    }
+
+    SECTION("Writing fields of the buffer overlay")
+    {
+        WireHeader header;
+        header.type = 0x0102;
+        header.length = 0x03040506;
+        header.flags.store(0x0708);
+        header.ratio = -2.0f;
+
+        std::array<uint8_t, 12> buffer{};
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        REQUIRE(buffer == std::array<uint8_t, 12>{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x07, 0xC0, 0x00, 0x00, 0x00});
+    }
+
+    SECTION("Default value")
+    {
+        const little_endian<int64_t> value;
+        REQUIRE(value == 0);
+
+        const big_endian<int32_t> negative{-5};
+        REQUIRE(negative == -5);
+    }
+}
+
+TEST_CASE("Memory: binary reader and writer - BinaryReader, BinaryWriter", "[memory][binary_cursor]")
+{
+    using toolbox::memory::endianness_t;
+
+    SECTION("Writing and reading back")
+    {
+        std::array<uint8_t, 32> buffer{};
+        toolbox::memory::BinaryWriter writer{buffer.data(), buffer.size()};
+        writer.write<uint16_t>(0xDEAD);
+        writer.write<uint32_t, endianness_t::little>(0x01020304);
+        writer.write<int8_t>(-1);
+        writer.write<double>(3.5);
+        writer.writeString("abc");
+        REQUIRE(writer.position() == 18);
+        REQUIRE(writer.remaining() == 14);
+
+        REQUIRE(buffer[0] == 0xDE);
+        REQUIRE(buffer[1] == 0xAD);
+        REQUIRE(buffer[2] == 0x04);
+        REQUIRE(buffer[5] == 0x01);
+
+        toolbox::memory::BinaryReader reader{buffer.data(), writer.position()};
+        REQUIRE(reader.read<uint16_t>() == 0xDEAD);
+        REQUIRE(reader.read<uint32_t, endianness_t::little>() == 0x01020304);
+        REQUIRE(reader.read<int8_t>() == -1);
+        REQUIRE(reader.read<double>() == 3.5);
+
+        const auto text = reader.readStringView(3);
+        REQUIRE(text == "abc");
+        REQUIRE(reinterpret_cast<const uint8_t *>(text.data()) == buffer.data() + 15);
+        REQUIRE(reader.remaining() == 0);
+    }
+
+    SECTION("Bounds checking")
+    {
+        const std::array<uint8_t, 5> buffer{1, 2, 3, 4, 5};
+        toolbox::memory::BinaryReader reader{buffer.data(), buffer.size()};
+        REQUIRE(reader.read<uint32_t>() == 0x01020304);
+        REQUIRE_THROWS_AS(reader.read<uint16_t>(), std::out_of_range);
+        REQUIRE_THROWS_AS(reader.readStringView(2), std::out_of_range);
+        REQUIRE_THROWS_AS(reader.skip(2), std::out_of_range);
+        REQUIRE(reader.position() == 4);
+        REQUIRE(*reader.readBytes(1) == 5);
+
+        std::array<uint8_t, 3> output{};
+        toolbox::memory::BinaryWriter writer{output.data(), output.size()};
+        REQUIRE_THROWS_AS(writer.write<uint32_t>(1), std::out_of_range);
+        REQUIRE_THROWS_AS(writer.writeString("abcd"), std::out_of_range);
+        REQUIRE_NOTHROW(writer.writeString("abc"));
+    }
+
+    SECTION("Batch with hoisted bounds check")
+    {
+        std::array<uint8_t, 12> buffer{};
+        toolbox::memory::BinaryWriter writer{buffer.data(), buffer.size()};
+        writer.require(3 * sizeof(uint32_t));
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            writer.writeUnchecked(i + 0xA0B0C0D0u);
+        }
+
+        toolbox::memory::BinaryReader reader{buffer.data(), buffer.size()};
+        REQUIRE_NOTHROW(reader.require(12));
+        REQUIRE_THROWS_AS(reader.require(13), std::out_of_range);
+        REQUIRE(reader.readUnchecked<uint32_t>() == 0xA0B0C0D0u);
+        REQUIRE(reader.readUnchecked<uint32_t>() == 0xA0B0C0D1u);
+        REQUIRE(reader.readUnchecked<uint32_t>() == 0xA0B0C0D2u);
+    }
+}
+
+TEST_CASE("Memory: varint encoding - encodeVarint, decodeVarint, decodeVarints", "[memory][varint]")
+{
+    SECTION("Zigzag encoding")
+    {
+        REQUIRE(toolbox::memory::zigzagEncode(int32_t{0}) == 0u);
+        REQUIRE(toolbox::memory::zigzagEncode(int32_t{-1}) == 1u);
+        REQUIRE(toolbox::memory::zigzagEncode(int32_t{1}) == 2u);
+        REQUIRE(toolbox::memory::zigzagEncode(int32_t{-2}) == 3u);
+        REQUIRE(toolbox::memory::zigzagEncode(std::numeric_limits<int64_t>::min()) == std::numeric_limits<uint64_t>::max());
+        REQUIRE(toolbox::memory::zigzagEncode(int8_t{127}) == 254u);
+
+        for (const int64_t value : {int64_t{0}, int64_t{-1}, int64_t{63}, int64_t{-64}, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()})
+        {
+            REQUIRE(toolbox::memory::zigzagDecode(toolbox::memory::zigzagEncode(value)) == value);
+        }
+        REQUIRE(toolbox::memory::zigzagDecode(toolbox::memory::zigzagEncode(int8_t{-128})) == -128);
+    }
+
+    SECTION("Known encodings")
+    {
+        std::array<uint8_t, toolbox::memory::maxVarintLength<uint64_t>> buffer{};
+        REQUIRE(toolbox::memory::maxVarintLength<uint64_t> == 10);
+        REQUIRE(toolbox::memory::maxVarintLength<uint32_t> == 5);
+
+        REQUIRE(toolbox::memory::encodeVarint(uint32_t{1}, buffer.data()) == 1);
+        REQUIRE(buffer[0] == 0x01);
+
+        REQUIRE(toolbox::memory::encodeVarint(uint32_t{300}, buffer.data()) == 2);
+        REQUIRE(buffer[0] == 0xAC);
+        REQUIRE(buffer[1] == 0x02);
+
+        REQUIRE(toolbox::memory::encodeVarint(std::numeric_limits<uint64_t>::max(), buffer.data()) == 10);
+        REQUIRE(buffer[9] == 0x01);
+
+        uint32_t value{0};
+        const std::array<uint8_t, 2> encoded{0xAC, 0x02};
+        REQUIRE(toolbox::memory::decodeVarint(encoded.data(), encoded.size(), value) == 2);
+        REQUIRE(value == 300);
+    }
+
+    SECTION("Malformed data")
+    {
+        uint32_t value{7};
+        const std::array<uint8_t, 2> truncated{0xAC, 0x82};
+        REQUIRE(toolbox::memory::decodeVarint(truncated.data(), truncated.size(), value) == 0);
+        REQUIRE(toolbox::memory::decodeVarint(truncated.data(), 0, value) == 0);
+
+        const std::array<uint8_t, 5> maxUint32{0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+        REQUIRE(toolbox::memory::decodeVarint(maxUint32.data(), maxUint32.size(), value) == 5);
+        REQUIRE(value == std::numeric_limits<uint32_t>::max());
+
+        const std::array<uint8_t, 5> tooBigForUint32{0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+        REQUIRE(toolbox::memory::decodeVarint(tooBigForUint32.data(), tooBigForUint32.size(), value) == 0);
+
+        const std::array<uint8_t, 12> tooBigForUint32Padded{0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+        REQUIRE(toolbox::memory::decodeVarint(tooBigForUint32Padded.data(), tooBigForUint32Padded.size(), value) == 0);
+
+        uint64_t wideValue{0};
+        const std::array<uint8_t, 11> tooLong{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01};
+        REQUIRE(toolbox::memory::decodeVarint(tooLong.data(), tooLong.size(), wideValue) == 0);
+
+        const std::array<uint8_t, 10> tooBigForUint64{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+        REQUIRE(toolbox::memory::decodeVarint(tooBigForUint64.data(), tooBigForUint64.size(), wideValue) == 0);
+
+        // overlong encoding of 0 for uint8_t is rejected regardless of how much input follows:
+        uint8_t narrowValue{7};
+        const std::array<uint8_t, 8> overlongUint8{0x80, 0x80, 0x00};
+        REQUIRE(toolbox::memory::decodeVarint(overlongUint8.data(), 3, narrowValue) == 0);
+        REQUIRE(toolbox::memory::decodeVarint(overlongUint8.data(), overlongUint8.size(), narrowValue) == 0);
+        REQUIRE(narrowValue == 7);
+
+        std::array<uint8_t, 2> narrowValues{};
+        size_t consumed{0};
+        REQUIRE_FALSE(toolbox::memory::decodeVarints(overlongUint8.data(), 3, narrowValues.data(), 1, consumed));
+        REQUIRE_FALSE(toolbox::memory::decodeVarints(overlongUint8.data(), overlongUint8.size(), narrowValues.data(), 1, consumed));
+    }
+
+    SECTION("Round trip of many values with single and batched decoding")
+    {
+        std::vector<uint64_t> values;
+        uint64_t state{7};
+        for (size_t i = 0; i < 5000; ++i)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            values.push_back(state >> (state % 64));
+        }
+
+        std::vector<uint8_t> encoded(values.size() * toolbox::memory::maxVarintLength<uint64_t>);
+        size_t size{0};
+        for (const auto value : values)
+        {
+            size += toolbox::memory::encodeVarint(value, encoded.data() + size);
+        }
+
+        size_t offset{0};
+        for (const auto value : values)
+        {
+            uint64_t decoded{0};
+            const auto length = toolbox::memory::decodeVarint(encoded.data() + offset, size - offset, decoded);
+            REQUIRE(length > 0);
+            REQUIRE(decoded == value);
+            offset += length;
+        }
+        REQUIRE(offset == size);
+
+        std::vector<uint64_t> decoded(values.size());
+        size_t consumed{0};
+        REQUIRE(toolbox::memory::decodeVarints(encoded.data(), size, decoded.data(), decoded.size(), consumed));
+        REQUIRE(consumed == size);
+        REQUIRE(decoded == values);
+
+        REQUIRE_FALSE(toolbox::memory::decodeVarints(encoded.data(), size - 1, decoded.data(), decoded.size(), consumed));
+        REQUIRE(consumed < size);
+    }
+
+    SECTION("Batched decoding of short varints")
+    {
+        std::vector<uint16_t> values;
+        for (uint32_t i = 0; i < 3000; ++i)
+        {
+            values.push_back(static_cast<uint16_t>(i * 37 % 20000));
+        }
+
+        std::vector<uint8_t> encoded(values.size() * toolbox::memory::maxVarintLength<uint16_t>);
+        size_t size{0};
+        for (const auto value : values)
+        {
+            size += toolbox::memory::encodeVarint(value, encoded.data() + size);
+        }
+
+        std::vector<uint16_t> decoded(values.size());
+        size_t consumed{0};
+        REQUIRE(toolbox::memory::decodeVarints(encoded.data(), size, decoded.data(), decoded.size(), consumed));
+        REQUIRE(consumed == size);
+        REQUIRE(decoded == values);
+
+        std::vector<uint8_t> narrow(values.size());
+        REQUIRE_FALSE(toolbox::memory::decodeVarints(encoded.data(), size, narrow.data(), narrow.size(), consumed));
+    }
+}
+
+namespace
+{
+    template <size_t width>
+    void checkBitPackingRoundTrip(const std::vector<uint64_t> &values)
+    {
+        constexpr uint64_t mask = width == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << width) - 1;
+
+        for (const size_t count : {size_t{0}, size_t{1}, size_t{7}, size_t{8}, size_t{9}, size_t{16}, size_t{17}, size_t{31}, size_t{64}, values.size()})
+        {
+            std::vector<uint8_t> packed(toolbox::memory::packedSize<width>(count));
+            REQUIRE(toolbox::memory::packBits<width>(values.data(), count, packed.data()) == packed.size());
+
+            std::vector<uint64_t> unpacked(count);
+            toolbox::memory::unpackBits<width>(packed.data(), count, unpacked.data());
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(unpacked[i] == (values[i] & mask));
+            }
+
+            std::vector<uint64_t> unpackedByScalarCode(count);
+            toolbox::memory::detail::unpackBitsScalar<width>(packed.data(), count, unpackedByScalarCode.data());
+            REQUIRE(unpacked == unpackedByScalarCode);
+        }
+    }
+
+    template <size_t... widths>
+    void checkBitPackingRoundTrips(const std::vector<uint64_t> &values, std::index_sequence<widths...>)
+    {
+        (checkBitPackingRoundTrip<widths + 1>(values), ...);
+    }
+}
+
+TEST_CASE("Memory: packing arbitrary width values - packBits, unpackBits", "[memory][chopping][packBits]")
+{
+    SECTION("Layout of 12-bit values")
+    {
+        const std::array<uint64_t, 2> values{0xABC, 0x123};
+        std::array<uint8_t, 3> packed{};
+        REQUIRE(toolbox::memory::packBits<12>(values.data(), values.size(), packed.data()) == 3);
+        REQUIRE(packed == std::array<uint8_t, 3>{0xBC, 0x3A, 0x12});
+    }
+
+    SECTION("Sizes")
+    {
+        REQUIRE(toolbox::memory::packedSize<1>(9) == 2);
+        REQUIRE(toolbox::memory::packedSize<20>(10) == 25);
+        REQUIRE(toolbox::memory::packedSize<37>(8) == 37);
+        REQUIRE(toolbox::memory::packedSize<64>(3) == 24);
+    }
+
+    SECTION("Higher bits are ignored")
+    {
+        const std::array<uint64_t, 3> values{0xFF, 0x1F0, 0x3};
+        std::array<uint8_t, 2> packed{};
+        REQUIRE(toolbox::memory::packBits<3>(values.data(), values.size(), packed.data()) == 2);
+
+        std::array<uint64_t, 3> unpacked{};
+        toolbox::memory::unpackBits<3>(packed.data(), unpacked.size(), unpacked.data());
+        REQUIRE(unpacked == std::array<uint64_t, 3>{7, 0, 3});
+    }
+
+    SECTION("Round trip for all widths")
+    {
+        std::vector<uint64_t> values(100);
+        uint64_t state{3};
+        for (auto &value : values)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            value = state;
+        }
+        values[5] = 0;
+        values[6] = std::numeric_limits<uint64_t>::max();
+
+        checkBitPackingRoundTrips(values, std::make_index_sequence<64>{});
+    }
+}
+
+namespace
+{
+    enum class MessageKind : uint8_t
+    {
+        request = 1,
+        response = 2
+    };
+
+    struct Message
+    {
+        uint32_t length{};
+        MessageKind kind{};
+        int16_t delta{};
+        double ratio{};
+        uint64_t id{};
+    };
+}
+
+TEST_CASE("Memory: compile time schema serialization - Schema", "[memory][schema]")
+{
+    using toolbox::memory::endianness_t;
+    using BigSchema = toolbox::memory::Schema<endianness_t::big, &Message::kind, &Message::length, &Message::delta, &Message::id>;
+    using LittleSchema = toolbox::memory::Schema<endianness_t::little, &Message::length, &Message::kind, &Message::delta, &Message::ratio, &Message::id>;
+
+    static_assert(BigSchema::encodedSize == 15);
+    static_assert(LittleSchema::encodedSize == 23);
+    static_assert(BigSchema::fieldOffsets[1] == 1 && BigSchema::fieldOffsets[2] == 5 && BigSchema::fieldOffsets[3] == 7);
+    static_assert(std::is_same<BigSchema::message_type, Message>::value);
+
+    Message message;
+    message.length = 0x01020304;
+    message.kind = MessageKind::response;
+    message.delta = -2;
+    message.ratio = 0.5;
+    message.id = 0x1112131415161718;
+
+    SECTION("Layout")
+    {
+        std::array<uint8_t, BigSchema::encodedSize> buffer{};
+        REQUIRE(BigSchema::serialize(message, buffer.data()) == buffer.size());
+        REQUIRE(buffer == std::array<uint8_t, 15>{0x02, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFE,
+                                                  0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18});
+    }
+
+    SECTION("Round trip")
+    {
+        std::array<uint8_t, LittleSchema::encodedSize> buffer{};
+        REQUIRE(LittleSchema::serialize(message, buffer.data()) == buffer.size());
+        REQUIRE(buffer[0] == 0x04);
+
+        Message decoded;
+        REQUIRE(LittleSchema::deserialize(buffer.data(), decoded) == buffer.size());
+        REQUIRE(decoded.length == message.length);
+        REQUIRE(decoded.kind == message.kind);
+        REQUIRE(decoded.delta == message.delta);
+        REQUIRE(decoded.ratio == message.ratio);
+        REQUIRE(decoded.id == message.id);
+    }
+
+    SECTION("Fields outside of the schema are untouched")
+    {
+        std::array<uint8_t, BigSchema::encodedSize> buffer{};
+        BigSchema::serialize(message, buffer.data());
+
+        Message decoded;
+        decoded.ratio = 7.0;
+        BigSchema::deserialize(buffer.data(), decoded);
+        REQUIRE(decoded.ratio == 7.0);
+        REQUIRE(decoded.id == message.id);
+    }
+}
+
+namespace
+{
+    template <toolbox::memory::bit_order_t bitOrder>
+    void checkBitStreamRoundTrip()
+    {
+        std::vector<std::pair<uint64_t, size_t>> fields;
+        uint64_t state{11};
+        size_t totalBits{0};
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            const size_t width = (state >> 58u) + (i % 3 == 0 ? 1 : 0);
+            const uint64_t value = width == 64 ? state : state & ((uint64_t{1} << width) - 1);
+            fields.emplace_back(value, width);
+            totalBits += width;
+        }
+
+        std::vector<uint8_t> buffer((totalBits + 7) / 8);
+        toolbox::memory::BitWriter<bitOrder> writer{buffer.data(), buffer.size()};
+        for (const auto &[value, width] : fields)
+        {
+            writer.write(value, width);
+        }
+        REQUIRE(writer.bitsWritten() == totalBits);
+        REQUIRE(writer.finish() == buffer.size());
+
+        toolbox::memory::BitReader<bitOrder> reader{buffer.data(), buffer.size()};
+        for (const auto &[value, width] : fields)
+        {
+            REQUIRE(reader.read(width) == value);
+        }
+        REQUIRE(reader.remainingBits() < 8);
+    }
+}
+
+TEST_CASE("Memory: bit stream - BitWriter, BitReader", "[memory][bit_stream]")
+{
+    using toolbox::memory::bit_order_t;
+
+    SECTION("MSB first layout")
+    {
+        std::array<uint8_t, 3> buffer{};
+        toolbox::memory::BitWriter<bit_order_t::msb_first> writer{buffer.data(), buffer.size()};
+        writer.write(0b101, 3);
+        writer.write(0b1, 1);
+        writer.write(0xABC, 12);
+        writer.write(0b11, 2);
+        REQUIRE(writer.finish() == 3);
+        REQUIRE(buffer == std::array<uint8_t, 3>{0xBA, 0xBC, 0xC0});
+
+        toolbox::memory::BitReader<bit_order_t::msb_first> reader{buffer.data(), buffer.size()};
+        REQUIRE(reader.read(3) == 0b101);
+        REQUIRE(reader.read(1) == 0b1);
+        REQUIRE(reader.read(12) == 0xABC);
+        REQUIRE(reader.read(2) == 0b11);
+        REQUIRE(reader.bitsRead() == 18);
+    }
+
+    SECTION("LSB first layout")
+    {
+        std::array<uint8_t, 3> buffer{};
+        toolbox::memory::BitWriter<bit_order_t::lsb_first> writer{buffer.data(), buffer.size()};
+        writer.write(0b101, 3);
+        writer.write(0b1, 1);
+        writer.write(0xABC, 12);
+        writer.write(0b11, 2);
+        REQUIRE(writer.finish() == 3);
+        REQUIRE(buffer == std::array<uint8_t, 3>{0xCD, 0xAB, 0x03});
+
+        toolbox::memory::BitReader<bit_order_t::lsb_first> reader{buffer.data(), buffer.size()};
+        REQUIRE(reader.read(3) == 0b101);
+        REQUIRE(reader.read(1) == 0b1);
+        REQUIRE(reader.read(12) == 0xABC);
+        REQUIRE(reader.read(2) == 0b11);
+    }
+
+    SECTION("Full words")
+    {
+        std::array<uint8_t, 17> buffer{};
+        toolbox::memory::BitWriter<bit_order_t::msb_first> writer{buffer.data(), buffer.size()};
+        writer.write(1, 1);
+        writer.write(0xDeadBeefAbbaBabe, 64);
+        writer.write(0x0123456789ABCDEF, 64);
+        REQUIRE(writer.finish() == 17);
+
+        toolbox::memory::BitReader<bit_order_t::msb_first> reader{buffer.data(), buffer.size()};
+        REQUIRE(reader.read(1) == 1);
+        REQUIRE(reader.read(64) == 0xDeadBeefAbbaBabe);
+        REQUIRE(reader.read(64) == 0x0123456789ABCDEF);
+        REQUIRE(reader.read(0) == 0);
+    }
+
+    SECTION("Mixed widths round trip")
+    {
+        checkBitStreamRoundTrip<bit_order_t::msb_first>();
+        checkBitStreamRoundTrip<bit_order_t::lsb_first>();
+    }
+
+    SECTION("Bounds checking")
+    {
+        std::array<uint8_t, 9> buffer{};
+        toolbox::memory::BitWriter<bit_order_t::lsb_first> writer{buffer.data(), buffer.size()};
+        writer.write(0, 64);
+        writer.write(0x7F, 7);
+        REQUIRE_THROWS_AS(writer.write(0, 64), std::out_of_range);
+
+        toolbox::memory::BitWriter<bit_order_t::msb_first> tightWriter{buffer.data(), 1};
+        tightWriter.write(0x3, 7);
+        tightWriter.write(0x1, 2);
+        REQUIRE_THROWS_AS(tightWriter.finish(), std::out_of_range);
+
+        toolbox::memory::BitReader<bit_order_t::msb_first> reader{buffer.data(), 2};
+        REQUIRE_NOTHROW(reader.read(10));
+        REQUIRE_THROWS_AS(reader.read(7), std::out_of_range);
+        REQUIRE(reader.read(6) == 0);
+    }
+}
+
+namespace
+{
+    template <typename T>
+    T referenceCrc(const uint8_t *data, size_t size, T polynomial)
+    {
+        T crc = ~T{0};
+        for (size_t i = 0; i < size; ++i)
+        {
+            crc ^= data[i];
+            for (size_t bit = 0; bit < 8; ++bit)
+            {
+                crc = static_cast<T>((crc & 1u) != 0 ? (crc >> 1u) ^ polynomial : crc >> 1u);
+            }
+        }
+        return static_cast<T>(~crc);
+    }
+}
+
+TEST_CASE("Memory: checksums - crc32, crc32c, crc64, adler32", "[memory][checksum]")
+{
+    using namespace toolbox::memory;
+
+    const std::string check{"123456789"};
+    const auto checkData = reinterpret_cast<const uint8_t *>(check.data());
+
+    std::vector<uint8_t> data(3 * 3 * 512 + 333);
+    uint32_t seed{12345};
+    for (auto &byte : data)
+    {
+        seed = seed * 1103515245u + 12345u;
+        byte = static_cast<uint8_t>(seed >> 24u);
+    }
+
+    SECTION("Check values")
+    {
+        REQUIRE(crc32(checkData, check.size()) == 0xCBF43926u);
+        REQUIRE(crc32c(checkData, check.size()) == 0xE3069283u);
+        REQUIRE(crc64(checkData, check.size()) == 0x995DC9BBDF1939FAu);
+        REQUIRE(adler32(checkData, check.size()) == 0x091E01DEu);
+
+        REQUIRE(crc32(nullptr, 0) == 0);
+        REQUIRE(crc32c(nullptr, 0) == 0);
+        REQUIRE(crc64(nullptr, 0) == 0);
+        REQUIRE(adler32(nullptr, 0) == 1);
+    }
+
+    SECTION("All sizes and alignments against bitwise computation")
+    {
+        for (const size_t offset : {size_t{0}, size_t{1}, size_t{7}})
+        {
+            for (size_t size = 0; size + offset <= data.size(); size += size < 300 ? 1 : 97)
+            {
+                const uint8_t *begin = data.data() + offset;
+                REQUIRE(crc32(begin, size) == referenceCrc<uint32_t>(begin, size, 0xEDB88320u));
+                REQUIRE(crc32c(begin, size) == referenceCrc<uint32_t>(begin, size, 0x82F63B78u));
+                REQUIRE(crc64(begin, size) == referenceCrc<uint64_t>(begin, size, 0xC96C5795D7870F42u));
+            }
+        }
+    }
+
+    SECTION("Incremental computation")
+    {
+        for (const size_t split : std::vector<size_t>{0, 1, 5, 64, 100, 1536, 4000})
+        {
+            REQUIRE(crc32(data.data() + split, data.size() - split, crc32(data.data(), split)) == crc32(data.data(), data.size()));
+            REQUIRE(crc32c(data.data() + split, data.size() - split, crc32c(data.data(), split)) == crc32c(data.data(), data.size()));
+            REQUIRE(crc64(data.data() + split, data.size() - split, crc64(data.data(), split)) == crc64(data.data(), data.size()));
+            REQUIRE(adler32(data.data() + split, data.size() - split, adler32(data.data(), split)) == adler32(data.data(), data.size()));
+        }
+    }
+
+    SECTION("Combining checksums of chunks")
+    {
+        for (const size_t split : std::vector<size_t>{0, 1, 5, 64, 100, 1536, 4000})
+        {
+            const size_t secondSize = data.size() - split;
+            const uint8_t *second = data.data() + split;
+            REQUIRE(crc32Combine(crc32(data.data(), split), crc32(second, secondSize), secondSize) == crc32(data.data(), data.size()));
+            REQUIRE(crc32cCombine(crc32c(data.data(), split), crc32c(second, secondSize), secondSize) == crc32c(data.data(), data.size()));
+            REQUIRE(crc64Combine(crc64(data.data(), split), crc64(second, secondSize), secondSize) == crc64(data.data(), data.size()));
+            REQUIRE(adler32Combine(adler32(data.data(), split), adler32(second, secondSize), secondSize) == adler32(data.data(), data.size()));
+        }
+        static_assert(crc32Combine(0xCBF43926u, 0, 0) == 0xCBF43926u, "Combining with empty buffer should keep the CRC.");
+    }
+
+    SECTION("Adler-32 sums reduced across long buffers")
+    {
+        const std::vector<uint8_t> ones(100000, 0xFF);
+        uint32_t sum{1};
+        uint32_t sumOfSums{0};
+        for (const auto byte : ones)
+        {
+            sum = (sum + byte) % 65521;
+            sumOfSums = (sumOfSums + sum) % 65521;
+        }
+        REQUIRE(adler32(ones.data(), ones.size()) == ((sumOfSums << 16u) | sum));
+    }
+}
@@ -1362,4 +1362,573 @@ TEST_CASE("String: convert hex string to single variable", "[string][transform]"
         REQUIRE_NOTHROW(result = toolbox::string::convertHexString<uint16_t>("1"));
         REQUIRE(result == 1);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("String: convert hex string without exceptions - tryConvertHexString", "[string][transform]")
+{
+    SECTION("Valid values")
+    {
+        uint16_t result{1};
+        REQUIRE(toolbox::string::tryConvertHexString<uint16_t>("0xABBA", result));
+        REQUIRE(result == 0xABBA);
+
+        REQUIRE(toolbox::string::tryConvertHexString<uint16_t>("0Xbc", result));
+        REQUIRE(result == 0xBC);
+
+        REQUIRE(toolbox::string::tryConvertHexString<uint16_t>("0000FFFF", result));
+        REQUIRE(result == 0xFFFF);
+
+        uint64_t wideResult{0};
+        REQUIRE(toolbox::string::tryConvertHexString<uint64_t>("0xDeadBeefAbbaBabe", wideResult));
+        REQUIRE(wideResult == 0xDeadBeefAbbaBabe);
+    }
+
+    SECTION("Zero values")
+    {
+        uint8_t result{1};
+        REQUIRE(toolbox::string::tryConvertHexString<uint8_t>("", result));
+        REQUIRE(result == 0);
+
+        result = 1;
+        REQUIRE(toolbox::string::tryConvertHexString<uint8_t>("0x", result));
+        REQUIRE(result == 0);
+
+        result = 1;
+        REQUIRE(toolbox::string::tryConvertHexString<uint8_t>("0x000", result));
+        REQUIRE(result == 0);
+    }
+
+    SECTION("Invalid values")
+    {
+        uint8_t result{1};
+        REQUIRE_FALSE(toolbox::string::tryConvertHexString<uint8_t>("0xABC", result));
+        REQUIRE(result == 0);
+
+        REQUIRE_FALSE(toolbox::string::tryConvertHexString<uint8_t>("0xZ", result));
+        REQUIRE_FALSE(toolbox::string::tryConvertHexString<uint8_t>("x1", result));
+        REQUIRE_FALSE(toolbox::string::tryConvertHexString<uint8_t>("1 ", result));
+        REQUIRE_FALSE(toolbox::string::tryConvertHexString<uint8_t>("0x0x1", result));
+    }
+}
+
+TEST_CASE("String: convert batch of hex strings to column - convertHexStrings", "[string][transform]")
+{
+    SECTION("Container of fields")
+    {
+        const std::vector<std::string_view> fields{"0xAB", "zz", "", "0x1FF", "10"};
+        std::vector<uint8_t> column;
+        std::vector<bool> errors;
+
+        REQUIRE(toolbox::string::convertHexStrings(fields, column, errors) == 2);
+        REQUIRE(column == std::vector<uint8_t>{0xAB, 0, 0, 0, 0x10});
+        REQUIRE(errors == std::vector<bool>{false, true, false, true, false});
+    }
+
+    SECTION("Appending to existing column")
+    {
+        const std::vector<std::string> fields{"1", "2"};
+        std::vector<uint32_t> column{7};
+        std::vector<bool> errors{false};
+
+        REQUIRE(toolbox::string::convertHexStrings(fields, column, errors) == 0);
+        REQUIRE(column == std::vector<uint32_t>{7, 1, 2});
+        REQUIRE(errors.size() == 3);
+    }
+
+    SECTION("Delimiter-separated buffer")
+    {
+        std::vector<uint16_t> column;
+        std::vector<bool> errors;
+
+        REQUIRE(toolbox::string::convertHexStrings<uint16_t>("0xABBA,beef,g,,ffff", ',', column, errors) == 1);
+        REQUIRE(column == std::vector<uint16_t>{0xABBA, 0xBEEF, 0, 0, 0xFFFF});
+        REQUIRE(errors == std::vector<bool>{false, false, true, false, false});
+
+        REQUIRE(toolbox::string::convertHexStrings<uint16_t>("", ',', column, errors) == 0);
+        REQUIRE(column.size() == 5);
+
+        REQUIRE(toolbox::string::convertHexStrings<uint16_t>("1;", ';', column, errors) == 0);
+        REQUIRE(column.size() == 7);
+    }
+
+    SECTION("Errors longer than column are appended to, not overwritten, by both overloads")
+    {
+        const std::vector<std::string> fields{"1", "x"};
+        std::vector<uint8_t> column;
+        std::vector<bool> errors{true, true, true};
+
+        REQUIRE(toolbox::string::convertHexStrings(fields, column, errors) == 1);
+        REQUIRE(column == std::vector<uint8_t>{1, 0});
+        REQUIRE(errors == std::vector<bool>{true, true, true, false, true});
+
+        std::vector<uint8_t> bufferColumn;
+        std::vector<bool> bufferErrors{true, true, true};
+        REQUIRE(toolbox::string::convertHexStrings<uint8_t>("1,x", ',', bufferColumn, bufferErrors) == 1);
+        REQUIRE(bufferColumn == column);
+        REQUIRE(bufferErrors == errors);
+    }
+}
+
+TEST_CASE("String: parse decimal string - parseDecimal", "[string][transform]")
+{
+    SECTION("Unsigned values")
+    {
+        uint32_t result{0};
+        REQUIRE(toolbox::string::parseDecimal("0", result));
+        REQUIRE(result == 0);
+
+        REQUIRE(toolbox::string::parseDecimal("12345678", result));
+        REQUIRE(result == 12345678);
+
+        REQUIRE(toolbox::string::parseDecimal("000000000004294967295", result));
+        REQUIRE(result == 4294967295);
+
+        uint64_t wideResult{0};
+        REQUIRE(toolbox::string::parseDecimal("18446744073709551615", wideResult));
+        REQUIRE(wideResult == std::numeric_limits<uint64_t>::max());
+
+        REQUIRE(toolbox::string::parseDecimal("1234567890123456789", wideResult));
+        REQUIRE(wideResult == 1234567890123456789u);
+    }
+
+    SECTION("Signed values")
+    {
+        int8_t result{0};
+        REQUIRE(toolbox::string::parseDecimal("-128", result));
+        REQUIRE(result == -128);
+        REQUIRE(toolbox::string::parseDecimal("127", result));
+        REQUIRE(result == 127);
+        REQUIRE(toolbox::string::parseDecimal("-0", result));
+        REQUIRE(result == 0);
+
+        int64_t wideResult{0};
+        REQUIRE(toolbox::string::parseDecimal("-9223372036854775808", wideResult));
+        REQUIRE(wideResult == std::numeric_limits<int64_t>::min());
+    }
+
+    SECTION("Overflow")
+    {
+        uint8_t result{7};
+        REQUIRE_FALSE(toolbox::string::parseDecimal("256", result));
+        REQUIRE(result == 7);
+
+        int8_t signedResult{0};
+        REQUIRE_FALSE(toolbox::string::parseDecimal("-129", signedResult));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("128", signedResult));
+
+        uint64_t wideResult{0};
+        REQUIRE_FALSE(toolbox::string::parseDecimal("18446744073709551616", wideResult));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("100000000000000000000", wideResult));
+    }
+
+    SECTION("Invalid strings")
+    {
+        uint64_t result{0};
+        REQUIRE_FALSE(toolbox::string::parseDecimal("", result));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("-1", result));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("+1", result));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("12 ", result));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("1234567/9", result));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("12345678:", result));
+
+        int32_t signedResult{0};
+        REQUIRE_FALSE(toolbox::string::parseDecimal("-", signedResult));
+        REQUIRE_FALSE(toolbox::string::parseDecimal("--1", signedResult));
+    }
+}
+
+TEST_CASE("String: format decimal value - formatDecimal", "[string][transform]")
+{
+    auto format = [](auto value)
+    {
+        std::array<char, toolbox::string::maxDecimalLength<decltype(value)>> buffer{};
+        return std::string(buffer.data(), toolbox::string::formatDecimal(value, buffer.data()));
+    };
+
+    SECTION("Corner values")
+    {
+        REQUIRE(format(uint8_t{0}) == "0");
+        REQUIRE(format(uint8_t{255}) == "255");
+        REQUIRE(format(int8_t{-128}) == "-128");
+        REQUIRE(format(std::numeric_limits<uint64_t>::max()) == "18446744073709551615");
+        REQUIRE(format(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+    }
+
+    SECTION("Round trip with std::to_string")
+    {
+        for (uint64_t value = 1; value < std::numeric_limits<uint64_t>::max() / 3; value = value * 3 + 1)
+        {
+            REQUIRE(format(value) == std::to_string(value));
+
+            uint64_t parsed{0};
+            REQUIRE(toolbox::string::parseDecimal(format(value), parsed));
+            REQUIRE(parsed == value);
+
+            const auto negative = -static_cast<int64_t>(value);
+            REQUIRE(format(negative) == std::to_string(negative));
+        }
+    }
+}
+
+TEST_CASE("String: Base64 encoding and decoding - encodeBase64, decodeBase64", "[string][transform]")
+{
+    using toolbox::string::base64_alphabet_t;
+
+    auto encode = [](std::string_view text, base64_alphabet_t alphabet, bool padding)
+    {
+        std::string encoded(toolbox::string::base64EncodedLength(text.size(), padding), '?');
+        const auto written = toolbox::string::encodeBase64(reinterpret_cast<const uint8_t *>(text.data()), text.size(), encoded.data(), alphabet, padding);
+        REQUIRE(written == encoded.size());
+        return encoded;
+    };
+
+    auto decode = [](std::string_view encoded, base64_alphabet_t alphabet, bool padding, std::string &decoded)
+    {
+        std::vector<uint8_t> buffer(toolbox::string::base64DecodedMaxLength(encoded.size()));
+        size_t written{0};
+        const bool valid = toolbox::string::decodeBase64(encoded, buffer.data(), written, alphabet, padding);
+        decoded.assign(buffer.cbegin(), buffer.cbegin() + static_cast<std::ptrdiff_t>(written));
+        return valid;
+    };
+
+    SECTION("RFC 4648 test vectors")
+    {
+        const std::vector<std::pair<std::string, std::string>> vectors{
+                {"",       ""},
+                {"f",      "Zg=="},
+                {"fo",     "Zm8="},
+                {"foo",    "Zm9v"},
+                {"foob",   "Zm9vYg=="},
+                {"fooba",  "Zm9vYmE="},
+                {"foobar", "Zm9vYmFy"}};
+
+        for (const auto &[text, encoded] : vectors)
+        {
+            REQUIRE(encode(text, base64_alphabet_t::standard, true) == encoded);
+            REQUIRE(encode(text, base64_alphabet_t::standard, false) == toolbox::string::removeChar(encoded, '='));
+
+            std::string decoded;
+            REQUIRE(decode(encoded, base64_alphabet_t::standard, true, decoded));
+            REQUIRE(decoded == text);
+            REQUIRE(decode(toolbox::string::removeChar(encoded, '='), base64_alphabet_t::standard, false, decoded));
+            REQUIRE(decoded == text);
+        }
+    }
+
+    SECTION("URL-safe alphabet")
+    {
+        const std::string text{"\xFB\xFF\xBF"};
+        REQUIRE(encode(text, base64_alphabet_t::standard, true) == "+/+/");
+        REQUIRE(encode(text, base64_alphabet_t::url_safe, true) == "-_-_");
+
+        std::string decoded;
+        REQUIRE(decode("-_-_", base64_alphabet_t::url_safe, true, decoded));
+        REQUIRE(decoded == text);
+        REQUIRE_FALSE(decode("-_-_", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("+/+/", base64_alphabet_t::url_safe, true, decoded));
+    }
+
+    SECTION("Strict validation")
+    {
+        std::string decoded;
+        REQUIRE_FALSE(decode("Zg=", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("Zg==", base64_alphabet_t::standard, false, decoded));
+        REQUIRE_FALSE(decode("Zh==", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("Zm9=", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("Z===", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("====", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("Zg==Zm8=", base64_alphabet_t::standard, true, decoded));
+        REQUIRE_FALSE(decode("Zm9 v", base64_alphabet_t::standard, false, decoded));
+        REQUIRE_FALSE(decode("Zm9vY", base64_alphabet_t::standard, false, decoded));
+    }
+
+    SECTION("Streaming in chunks of different sizes")
+    {
+        std::string text;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            text.push_back(static_cast<char>(i * 7 + i / 3));
+        }
+
+        for (const bool padding : {true, false})
+        {
+            for (size_t chunkSize = 1; chunkSize < 10; ++chunkSize)
+            {
+                toolbox::string::Base64Encoder encoder{base64_alphabet_t::url_safe, padding};
+                std::string encoded;
+                std::array<char, 32> encodedChunk{};
+                for (size_t offset = 0; offset < text.size(); offset += chunkSize)
+                {
+                    const auto size = std::min(chunkSize, text.size() - offset);
+                    const auto written = encoder.update(reinterpret_cast<const uint8_t *>(text.data()) + offset, size, encodedChunk.data());
+                    encoded.append(encodedChunk.data(), written);
+                }
+                encoded.append(encodedChunk.data(), encoder.finish(encodedChunk.data()));
+                REQUIRE(encoded == encode(text, base64_alphabet_t::url_safe, padding));
+
+                toolbox::string::Base64Decoder decoder{base64_alphabet_t::url_safe, padding};
+                std::string decoded;
+                std::array<uint8_t, 32> decodedChunk{};
+                size_t written{0};
+                for (size_t offset = 0; offset < encoded.size(); offset += chunkSize)
+                {
+                    REQUIRE(decoder.update(std::string_view{encoded}.substr(offset, chunkSize), decodedChunk.data(), written));
+                    decoded.append(decodedChunk.cbegin(), decodedChunk.cbegin() + static_cast<std::ptrdiff_t>(written));
+                }
+                REQUIRE(decoder.finish(decodedChunk.data(), written));
+                decoded.append(decodedChunk.cbegin(), decodedChunk.cbegin() + static_cast<std::ptrdiff_t>(written));
+                REQUIRE(decoded == text);
+            }
+        }
+    }
+
+    SECTION("Streaming validation")
+    {
+        std::array<uint8_t, 32> buffer{};
+        size_t written{0};
+
+        toolbox::string::Base64Decoder decoder;
+        REQUIRE(decoder.update("Zm", buffer.data(), written));
+        REQUIRE(decoder.update("8=", buffer.data(), written));
+        REQUIRE(written == 2);
+        REQUIRE_FALSE(decoder.update("Zm9v", buffer.data(), written));
+        REQUIRE_FALSE(decoder.finish(buffer.data(), written));
+
+        REQUIRE(decoder.update("Zm9vY", buffer.data(), written));
+        REQUIRE_FALSE(decoder.finish(buffer.data(), written));
+
+        toolbox::string::Base64Decoder unpaddedDecoder{base64_alphabet_t::standard, false};
+        REQUIRE(unpaddedDecoder.update("Zm9vYg", buffer.data(), written));
+        REQUIRE(unpaddedDecoder.finish(buffer.data(), written));
+        REQUIRE(written == 1);
+        REQUIRE(buffer[0] == 'b');
+    }
+
+    SECTION("Vectorized and scalar code give the same results")
+    {
+        std::vector<uint8_t> data(300);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 151 + i / 7);
+        }
+
+        for (const auto alphabet : {base64_alphabet_t::standard, base64_alphabet_t::url_safe})
+        {
+            const auto &characters = toolbox::string::detail::base64Alphabets[static_cast<size_t>(alphabet)];
+            const auto &values = toolbox::string::detail::base64Values[static_cast<size_t>(alphabet)];
+            for (size_t groupsCount = 0; groupsCount <= data.size() / 3; groupsCount += 1 + groupsCount / 8)
+            {
+                std::string encoded(groupsCount * 4, '?');
+                std::string expected(groupsCount * 4, '?');
+                toolbox::string::detail::encodeBase64Groups(data.data(), groupsCount, encoded.data(), characters);
+                toolbox::string::detail::encodeBase64GroupsScalar(data.data(), groupsCount, expected.data(), characters);
+                REQUIRE(encoded == expected);
+
+                std::vector<uint8_t> decoded(groupsCount * 3);
+                REQUIRE(toolbox::string::detail::decodeBase64Groups(encoded.data(), groupsCount, decoded.data(), characters, values) == groupsCount);
+                REQUIRE(std::equal(decoded.cbegin(), decoded.cend(), data.cbegin()));
+
+                for (const char invalid : {'=', ' ', '\x80', '\xC1', '@', '[', '`', '{', ':', characters[62] == '+' ? '-' : '+',
+                                           characters[63] == '/' ? '_' : '/'})
+                {
+                    for (size_t position = 0; position < encoded.size(); position += 13)
+                    {
+                        std::string corrupted = encoded;
+                        corrupted[position] = invalid;
+                        REQUIRE(toolbox::string::detail::decodeBase64Groups(corrupted.data(), groupsCount, decoded.data(), characters, values) == position / 4);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("String: hex encoding and hexdump - encodeHex, hexDump", "[string][transform]")
+{
+    SECTION("encodeHex")
+    {
+        const std::array<uint8_t, 4> data{0xDE, 0xAD, 0x0B, 0x01};
+        std::array<char, 8> encoded{};
+
+        REQUIRE(toolbox::string::encodeHex(data.data(), data.size(), encoded.data()) == 8);
+        REQUIRE(std::string_view(encoded.data(), encoded.size()) == "dead0b01");
+
+        REQUIRE(toolbox::string::encodeHex(data.data(), data.size(), encoded.data(), true) == 8);
+        REQUIRE(std::string_view(encoded.data(), encoded.size()) == "DEAD0B01");
+
+        REQUIRE(toolbox::string::encodeHex(data.data(), 0, encoded.data()) == 0);
+    }
+
+    SECTION("hexDump of short data")
+    {
+        const std::string data{"Hello World\n\x00\x01\x02\x03" "foo", 19};
+        std::string dump;
+        toolbox::string::hexDump(reinterpret_cast<const uint8_t *>(data.data()), data.size(), [&dump](std::string_view block)
+        {
+            dump += block;
+        });
+
+        REQUIRE(dump ==
+                "00000000  48 65 6c 6c 6f 20 57 6f  72 6c 64 0a 00 01 02 03  |Hello World.....|\n"
+                "00000010  66 6f 6f                                          |foo|\n");
+    }
+
+    SECTION("hexDump of empty data")
+    {
+        size_t calls{0};
+        toolbox::string::hexDump(nullptr, 0, [&calls](std::string_view)
+        {
+            ++calls;
+        });
+        REQUIRE(calls == 0);
+    }
+
+    SECTION("hexDump streams whole lines in blocks")
+    {
+        std::vector<uint8_t> data(100000);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i);
+        }
+
+        size_t blocks{0};
+        std::string dump;
+        toolbox::string::hexDump(data.data(), data.size(), [&](std::string_view block)
+        {
+            ++blocks;
+            REQUIRE(toolbox::string::endsWith(block, '\n'));
+            dump += block;
+        }, 0xFFFFFFF0u);
+
+        REQUIRE(blocks > 1);
+        REQUIRE(static_cast<size_t>(std::count(dump.cbegin(), dump.cend(), '\n')) == (data.size() + 15) / 16);
+        REQUIRE(toolbox::string::startsWith(dump, "00000000fffffff0  00 01 02"));
+        REQUIRE(toolbox::string::contains(dump, "\n0000000100000000  10 11 12"));
+    }
+
+    SECTION("Vectorized and scalar code give the same results")
+    {
+        std::vector<uint8_t> data(256 + 100);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i < 256 ? i : i * 73);
+        }
+
+        for (const bool uppercase : {false, true})
+        {
+            for (size_t size = 0; size <= data.size(); size += 1 + size / 16)
+            {
+                std::string encoded(2 * size, '?');
+                std::string expected(2 * size, '?');
+                REQUIRE(toolbox::string::encodeHex(data.data(), size, encoded.data(), uppercase) == encoded.size());
+                toolbox::string::detail::encodeHexScalar(data.data(), size, expected.data(), uppercase);
+                REQUIRE(encoded == expected);
+            }
+        }
+
+        for (size_t offset = 0; offset + 16 <= data.size(); offset += 16)
+        {
+            std::array<char, 80> line{};
+            std::array<char, 80> expectedLine{};
+            const size_t length = toolbox::string::detail::writeHexDumpLine(offset, 8, data.data() + offset, 16, line.data());
+            const auto *expectedEnd = toolbox::string::detail::writeHexDumpColumnsScalar(data.data() + offset, 16, expectedLine.data() + 9);
+            std::copy(line.cbegin(), line.cbegin() + 9, expectedLine.begin());
+            REQUIRE(length == static_cast<size_t>(expectedEnd - expectedLine.data()));
+            REQUIRE(line == expectedLine);
+        }
+    }
+}
+
+TEST_CASE("String: UUID parsing and formatting - parseUuid, formatUuid", "[string][transform]")
+{
+    using toolbox::string::uuid_format_t;
+    const std::array<uint8_t, 16> expected{0x12, 0x3e, 0x45, 0x67, 0xe8, 0x9b, 0x12, 0xd3, 0xa4, 0x56, 0x42, 0x66, 0x14, 0x17, 0x40, 0x00};
+
+    SECTION("Parsing all formats")
+    {
+        std::array<uint8_t, 16> uuid{};
+        REQUIRE(toolbox::string::parseUuid("123e4567-e89b-12d3-a456-426614174000", uuid));
+        REQUIRE(uuid == expected);
+
+        uuid = {};
+        REQUIRE(toolbox::string::parseUuid("{123E4567-E89B-12D3-A456-426614174000}", uuid));
+        REQUIRE(uuid == expected);
+
+        uuid = {};
+        REQUIRE(toolbox::string::parseUuid("123e4567e89b12d3a456426614174000", uuid));
+        REQUIRE(uuid == expected);
+    }
+
+    SECTION("Parsing invalid text")
+    {
+        std::array<uint8_t, 16> uuid{};
+        REQUIRE_FALSE(toolbox::string::parseUuid("", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567-e89b-12d3-a456-42661417400", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567-e89b-12d3-a456-4266141740000", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567+e89b-12d3-a456-426614174000", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567-e89b-12d3-a456-42661417400g", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("(123e4567-e89b-12d3-a456-426614174000)", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567-e89b12d3-a456-4266141740000", uuid));
+        REQUIRE_FALSE(toolbox::string::parseUuid("123e4567e89b12d3a45642661417400-", uuid));
+        REQUIRE(uuid == std::array<uint8_t, 16>{});
+    }
+
+    SECTION("Formatting and round trip")
+    {
+        std::array<char, toolbox::string::uuidLength(uuid_format_t::braced)> buffer{};
+        for (const auto format : {uuid_format_t::canonical, uuid_format_t::braced, uuid_format_t::compact})
+        {
+            const auto length = toolbox::string::formatUuid(expected, buffer.data(), format);
+            REQUIRE(length == toolbox::string::uuidLength(format));
+
+            std::array<uint8_t, 16> uuid{};
+            REQUIRE(toolbox::string::parseUuid(std::string_view(buffer.data(), length), uuid));
+            REQUIRE(uuid == expected);
+        }
+
+        REQUIRE(std::string_view(buffer.data(), toolbox::string::formatUuid(expected, buffer.data())) == "123e4567-e89b-12d3-a456-426614174000");
+        REQUIRE(std::string_view(buffer.data(), toolbox::string::formatUuid(expected, buffer.data(), uuid_format_t::braced)) ==
+                "{123e4567-e89b-12d3-a456-426614174000}");
+        REQUIRE(std::string_view(buffer.data(), toolbox::string::formatUuid(expected, buffer.data(), uuid_format_t::compact)) ==
+                "123e4567e89b12d3a456426614174000");
+    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    SECTION("Vectorized and scalar code give the same results")
+    {
+        if (toolbox::string::detail::hasSsse3())
+        {
+            std::array<uint8_t, 16> uuid{};
+            for (size_t round = 0; round < 16; ++round)
+            {
+                for (size_t i = 0; i < uuid.size(); ++i)
+                {
+                    uuid[i] = static_cast<uint8_t>(round * 37 + i * 11 + (round * i) / 3);
+                }
+
+                for (const bool dashed : {true, false})
+                {
+                    std::array<char, 36> text{};
+                    std::array<char, 36> expectedText{};
+                    const size_t length = toolbox::string::detail::encodeUuidSsse3(uuid, dashed, text.data());
+                    REQUIRE(length == toolbox::string::detail::encodeUuidScalar(uuid, dashed, expectedText.data()));
+                    REQUIRE(text == expectedText);
+
+                    for (size_t position = 0; position < length; ++position)
+                    {
+                        for (const char character : {'0', '9', 'a', 'f', 'A', 'F', '/', ':', '@', 'G', '`', 'g', '-', '\xB0'})
+                        {
+                            std::string changed(text.data(), length);
+                            changed[position] = character;
+                            std::array<uint8_t, 16> parsed{};
+                            std::array<uint8_t, 16> expectedParsed{};
+                            const bool valid = toolbox::string::detail::decodeUuidScalar(changed, dashed, expectedParsed);
+                            REQUIRE(toolbox::string::detail::decodeUuidSsse3(changed, dashed, parsed) == valid);
+                            REQUIRE(parsed == expectedParsed);
+                        }
+                    }
+                }
+            }
+        }
+    }
+#endif
+}